@@ -114,7 +114,7 @@ int main(int argc, char** argv)
 
 
     // 启动 RPC 服务节点，进入阻塞状态，等待远程的 RPC 调用请求
-    provider.run();
+    provider.Run();
 
 
     return 0;
@@ -1,6 +1,7 @@
 #include "krpcApplication.h"
 #include "../user.pb.h"
 #include "krpcController.h"
+#include "krpcCallContext.h"
 #include "krpcLogger.h"
 
 #include <iostream>
@@ -23,21 +24,21 @@ void send_request(int thread_id,                    // 线程编号（未使用
     request.set_name("zhangsan");
     request.set_pwd("123456");
 
-    // 定义 RPC 方法的响应消息
+    // 定义 RPC 方法的响应消息（请求和响应对象在循环中复用）
     kuser::LoginResponse response;
 
-    // 创建控制器对象，存储 RPC 调用状态（错误信息）
-    KrpcController controller; 
-
     for (int i = 0; i < request_per_thread; ++i)
     {
+        // 取当前线程复用的控制器（已重置），存储 RPC 调用状态（错误信息）
+        KrpcController& controller = KrpcCallContext::Controller();
+
         // 调用远程方法 Login
         stub.Login(&controller, &request, &response, nullptr);
 
         // 检查 RPC 是否调用成功
         if (controller.Failed()) // RPC 调用失败，输出错误信息（RPC 的错误）
         {
-            std::cout << controller.ErrorText() << std::endl;
+            std::cout << controller.ErrorTextRef() << std::endl;
             fail_count++; // 失败计数 + 1
         }
         else // RPC 调用成功，检查响应的 errcode
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <google/protobuf/arena.h>
+
+
+/*
+KrpcArenaPool 为服务端的每次调用提供一个 google::protobuf::Arena：
+    - 请求、响应以及它们的所有子消息、字符串字段都从同一个 Arena 上分配，调用结束时随 Arena 一起整体释放，
+      处理一次调用不再需要零散的 malloc / free
+    - 每个 Arena 自带一块初始内存（kInitialBlockSize），小消息完全在初始块中分配
+    - Arena 用完后 Reset（释放初始块以外的内存、执行析构）并放回池中：先放进当前线程的缓存，满了再放进全局无锁队列，
+      调用通常在 I/O 线程开始、在业务线程结束，全局队列让 Arena 可以在线程之间流转复用
+
+    Arena 上的消息由 Arena 管理，不能 delete；服务方法里也不要把 Arena 上的子消息 release 出去长期持有
+*/
+
+class KrpcArenaPool
+{
+public:
+    static const size_t kInitialBlockSize = 8 * 1024;   // 每个 Arena 自带的初始内存块大小
+    static const size_t kMaxLocalArenas = 16;           // 每个线程最多缓存的 Arena 数
+    static const size_t kMaxGlobalArenas = 1024;        // 全局队列最多缓存的 Arena 数
+
+    // 取出一个空的 Arena（线程安全）
+    static google::protobuf::Arena* Acquire();
+
+    // 归还 Arena，上面分配的所有消息随之释放（线程安全，可以在与 Acquire 不同的线程中调用）
+    static void Release(google::protobuf::Arena* arena);
+};
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <google/protobuf/service.h>
+#include "krpcChannel.h"
+#include "krpcController.h"
+#include "krpcClosure.h"
+
+#include <functional>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+
+/*
+KrpcAsyncStub 在 protoc 生成的 Stub 之上提供 future / 回调两种异步调用方式，业务代码不用再手动管理 Controller、Response、Closure 的生命周期：
+
+    class UserServiceAsyncStub : public KrpcAsyncStub<kuser::UserServiceRpc_Stub>
+    {
+    public:
+        using KrpcAsyncStub::KrpcAsyncStub;
+        KRPC_ASYNC_METHOD(Login)
+        KRPC_ASYNC_METHOD(Register)
+    };
+
+    UserServiceAsyncStub stub(new KrpcChannel(false));
+
+    // 1. future：同时发出多个请求，再逐个 get()，调用失败时 get() 抛出 KrpcException
+    std::future<kuser::LoginResponse> f1 = stub.LoginAsync(req1);
+    std::future<kuser::LoginResponse> f2 = stub.LoginAsync(req2);
+    kuser::LoginResponse r1 = f1.get();
+
+    // 2. 回调：调用结束后在客户端 I/O 线程中执行，回调里不要做耗时操作，也不要发起同步调用
+    stub.LoginAsync(req3, [](const KrpcController& cntl, kuser::LoginResponse& response) {
+        if (cntl.Failed()) { ... }
+    });
+
+    - 请求在发起调用时就已经序列化发送，request 对象不需要在调用结束前一直保持有效
+    - Controller、Response 由框架在堆上创建，调用结束后自动释放
+*/
+
+
+// RPC 调用失败（网络错误、服务端返回错误等），what() 为 Controller 中的错误信息
+class KrpcException : public std::runtime_error
+{
+public:
+    explicit KrpcException(const std::string& reason) : std::runtime_error(reason) {}
+};
+
+
+// 从生成代码中的方法指针推导出请求、响应类型
+// Stub 方法的签名固定为：void Method(RpcController*, const Request*, Response*, Closure*)
+template <typename MethodPtr>
+struct KrpcMethodTraits;
+
+template <typename Stub, typename Req, typename Resp>
+struct KrpcMethodTraits<void (Stub::*)(google::protobuf::RpcController*, const Req*, Resp*, google::protobuf::Closure*)>
+{
+    typedef Stub StubType;
+    typedef Req Request;
+    typedef Resp Response;
+};
+
+
+template <typename Stub>
+class KrpcAsyncStub
+{
+public:
+    typedef Stub StubType;
+
+    // stub 接管 channel 的所有权，与 protoc 生成的 Stub(RpcChannel*, STUB_OWNS_CHANNEL) 语义一致
+    explicit KrpcAsyncStub(KrpcChannel* channel)
+        : m_stub(channel, google::protobuf::Service::STUB_OWNS_CHANNEL) {}
+
+    // 仍然可以通过原始 Stub 发起同步调用
+    Stub& stub() { return m_stub; }
+
+    // future 方式：返回的 future 在调用结束时就绪，失败时 get() 抛出 KrpcException
+    template <typename MethodPtr>
+    std::future<typename KrpcMethodTraits<MethodPtr>::Response>
+    Async(MethodPtr method, const typename KrpcMethodTraits<MethodPtr>::Request& request)
+    {
+        typedef typename KrpcMethodTraits<MethodPtr>::Response Response;
+
+        struct CallState
+        {
+            KrpcController controller;
+            Response response;
+            std::promise<Response> promise;
+        };
+
+        std::shared_ptr<CallState> state = std::make_shared<CallState>();
+        std::future<Response> future = state->promise.get_future();
+
+        google::protobuf::Closure* done = new KrpcClosure([state]() {
+            if (state->controller.Failed())
+            {
+                state->promise.set_exception(std::make_exception_ptr(KrpcException(state->controller.ErrorText())));
+            }
+            else
+            {
+                state->promise.set_value(std::move(state->response));
+            }
+        });
+
+        (m_stub.*method)(&state->controller, &request, &state->response, done);
+        return future;
+    }
+
+    // 回调方式：callback(const KrpcController&, Response&) 在调用结束时于 I/O 线程中执行
+    template <typename MethodPtr, typename Callback>
+    void Async(MethodPtr method, const typename KrpcMethodTraits<MethodPtr>::Request& request, Callback callback)
+    {
+        typedef typename KrpcMethodTraits<MethodPtr>::Response Response;
+
+        struct CallState
+        {
+            KrpcController controller;
+            Response response;
+        };
+
+        std::shared_ptr<CallState> state = std::make_shared<CallState>();
+        google::protobuf::Closure* done = new KrpcClosure([state, callback]() mutable {
+            callback(static_cast<const KrpcController&>(state->controller), state->response);
+        });
+
+        (m_stub.*method)(&state->controller, &request, &state->response, done);
+    }
+
+private:
+    Stub m_stub;
+};
+
+
+// 为 Stub 中的方法 Name 生成 NameAsync(request) 和 NameAsync(request, callback) 两个重载
+#define KRPC_ASYNC_METHOD(Name)                                                                         \
+    std::future<KrpcMethodTraits<decltype(&StubType::Name)>::Response>                                  \
+    Name##Async(const KrpcMethodTraits<decltype(&StubType::Name)>::Request& request)                    \
+    {                                                                                                   \
+        return this->Async(&StubType::Name, request);                                                   \
+    }                                                                                                   \
+    template <typename Callback>                                                                        \
+    void Name##Async(const KrpcMethodTraits<decltype(&StubType::Name)>::Request& request, Callback cb)  \
+    {                                                                                                   \
+        this->Async(&StubType::Name, request, std::move(cb));                                           \
+    }
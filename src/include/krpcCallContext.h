@@ -0,0 +1,52 @@
+#pragma once
+
+#include "krpcController.h"
+#include "krpcHeader.pb.h"
+#include "krpcIOBuf.h"
+
+
+/*
+KrpcCallContext 是客户端每个线程复用的调用上下文，保存 KrpcChannel::CallMethod 每次调用都要用到的对象：
+    - 请求头 rpcHeader：字符串字段重新赋值时复用已有的容量，服务名、方法名不会每次重新申请内存
+    - 请求帧 KrpcIOBuf：块引用存放在对象内部，内存块取自线程缓存，发送完立即归还
+    - 可以反复 Reset 的 KrpcController，供业务代码发起调用时使用（Controller()）
+
+    调用方再复用自己的请求和响应对象（见 example/caller），同步的小请求在稳定状态下调用线程和 I/O 线程都不再申请堆内存
+    （test/callcontext_alloc_test.cc）；protobuf 解析响应前的 Clear 会释放 proto3 的子消息字段，响应带子消息时仍有这部分分配
+
+    CallMethod 通过 KrpcCallContext::Scope 借用当前线程的上下文；同一线程上发生嵌套调用
+    （例如调用失败时 done 在调用线程中执行、又发起了新的调用）时上下文已被占用，临时创建一个新的
+*/
+
+class KrpcCallContext
+{
+public:
+    krpc::rpcHeader& Header() { return m_header; }
+    KrpcIOBuf& Frame() { return m_frame; }
+
+    // 当前线程可复用的控制器，返回前已经 Reset，每次发起调用前取一次即可
+    // 异步调用的控制器要一直有效到 done 执行，不要在调用结束前再次取用
+    static KrpcController& Controller();
+
+    // 在作用域内借用当前线程的调用上下文
+    class Scope
+    {
+    public:
+        Scope();
+        ~Scope();
+
+        KrpcCallContext* operator->() const { return m_context; }
+
+    private:
+        KrpcCallContext* m_context;
+        bool m_temporary;   // 上下文被占用时临时创建的，离开作用域时删除
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+
+private:
+    krpc::rpcHeader m_header;
+    KrpcIOBuf m_frame;
+    bool m_inUse = false;
+};
@@ -1,12 +1,20 @@
 #pragma once
 
 #include <google/protobuf/service.h>
-#include "zookeeperutil.h"
+#include "krpcServiceDiscovery.h"
+#include "krpcLoadBalancer.h"
+#include "krpcConnectionPool.h"
+#include "krpcController.h"
+
+#include <memory>
+#include <string>
 
 
 // 客户端调用远程服务时，stub（代理类）会将请求传给 rpcChannel 的 CallMehod()，由其进行实际的发送
 // 因此你只要实现 CallMethod()，就能实现完整的RPC客户端调用
 
+struct KrpcChannelState;
+
 class KrpcChannel : public google::protobuf::RpcChannel // 继承google::protobuf::RpcChannel，是 Protobuf 的远程调用通道接口
 {
 public:
@@ -17,13 +25,23 @@ public:
     * 核心方法：CallMethod()，实现 Protobuf 框架定义的虚函数 CallMethod()
     * stub 代理类在调用远程方法时，最终都会调用到此函数，统一做 rpc 方法调用的数据序列化和网络发送。
     * 它负责：
-    * 1. 从 ZooKeeper 查询服务地址
-    * 2. 建立 Socket 连接
+    * 1. 从服务发现缓存（KrpcServiceDiscovery）查询服务实例，由负载均衡器选出一个实例
+    * 2. 从全局连接池取得到服务端的连接（多路复用，多个调用共享）
     * 3. 将请求序列化，并发送给服务端
     * 4. 接收响应并反序列化，并返回结果
     */
 
     // RPC 调用的核心方法，负责将客户端的请求序列化并发送到服务端，同时接收服务端的响应
+    // done 为空时同步等待响应；done 非空时异步调用，调用结束后在客户端 I/O 线程中执行 done->Run()
+    // 调用的时限取自 KrpcController::SetTimeoutMs，没有设置时为配置项 rpcclient_timeout_ms，超时后调用以失败结束
+    // 在服务方法中发起的调用还受上游请求剩余时限的约束，并带上上游的调用链id（见 krpcRequestContext.h）
+    // 控制器为 KrpcController 时，在其他线程中调用 StartCancel 可以取消调用，服务端同时收到取消通知
+    // 开启对冲（rpcclient_hedge）且有多个实例时，调用迟迟没有结束会向另一个实例发出备份请求，先成功的作为结果
+    // 开启重试（rpcclient_retry_methods，见 krpcRetryPolicy.h）的方法失败后按退避时间重试，控制器需要是 KrpcController
+    // 异步调用的 request 在 CallMethod 返回后就可以释放，channel 也可以析构：备份请求和重试使用请求的副本和 channel 的共享状态
+    // 注意：done 在 I/O 线程中执行，回调里不要再发起同步调用，否则会阻塞 I/O 线程；
+    //      回调里可以继续发起异步调用，需要新建连接时这次调用交给建立连接的线程发出，不会在 I/O 线程中握手
+    //      配置 client_callback_threads 后 done 改为在回调工作线程中执行
     void CallMethod(const ::google::protobuf::MethodDescriptor* method, // 调用哪个服务、哪个方法
                     ::google::protobuf::RpcController* controller, // 上下文控制器
                     const ::google::protobuf::Message* request,    // 请求参数
@@ -32,20 +50,8 @@ public:
 
 
 private:
-    int m_clientfd;             // 当前客户端sockfd
-
-    std::string service_name;   // 当前调用的RPC服务名称，如："UserService"
-    std::string method_name;    // 当前调用的服务方法名称，如："Login" "Register"
-    
-    std::string m_ip;           // 从zookeeper获取的服务端 ip
-    uint16_t m_port;            // 从zookeeper获取的服务端 port
-    
-    int m_idx; // // 字符串中':'分隔符的位置，划分服务器ip和port的下标
-
-    // 创建新的socket连接
-    bool newConnect(const char* ip, uint16_t port);
-
-    // 从ZooKeeper查询指定服务方法的服务端地址 ip:port
-    std::string QueryServiceHost(ZkClient* zkclient, std::string service_name, std::string method_name, int& idx);
+    // 实例列表缓存、负载均衡器、默认时限、对冲和重试策略（见 krpcChannel.cc）
+    // 备份请求和异步重试在 CallMethod 返回后才发出，它们与 channel 共同持有这份状态
+    std::shared_ptr<KrpcChannelState> m_state;
 };
 
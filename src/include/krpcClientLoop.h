@@ -0,0 +1,95 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <stdint.h>
+
+class KrpcConnection;
+class KrpcExecutor;
+
+
+/*
+KrpcClientLoop 是客户端的 I/O 事件循环，一个 KrpcClientLoop 对应一个线程 + 一个 epoll：
+    - 负责它名下所有 KrpcConnection 的读事件（接收并分发响应）和写事件（发送缓冲区里没写完的请求）
+    - 其他线程通过 RunInLoop / QueueInLoop 把任务投递到循环线程执行，用 eventfd 唤醒 epoll_wait
+    - 注册到循环上的连接由循环持有一份 shared_ptr，保证处理事件期间连接对象不会被销毁
+
+KrpcClientLoopPool 是全局唯一的事件循环池，连接建立时轮询分配一个事件循环，
+少量 I/O 线程就可以驱动所有连接上的大量并发调用
+*/
+
+class KrpcClientLoop
+{
+public:
+    typedef std::function<void()> Task;
+
+    KrpcClientLoop();
+    ~KrpcClientLoop(); // 退出循环并等待线程结束
+
+    // 在循环线程中执行任务：当前就在循环线程则立即执行，否则投递到任务队列
+    void RunInLoop(Task task);
+
+    // 投递任务到任务队列，下一轮循环执行
+    void QueueInLoop(Task task);
+
+    bool IsInLoopThread() const { return std::this_thread::get_id() == m_threadId.load(std::memory_order_acquire); }
+
+    // 当前线程是否是某个客户端事件循环的线程（异步调用的 done 默认就在这里执行）
+    static bool InClientLoopThread();
+
+    // 以下函数只能在循环线程中调用
+    void AddConnection(const std::shared_ptr<KrpcConnection>& conn, int fd); // 注册连接，开始监听读事件
+    void UpdateConnection(int fd, uint32_t events);                          // 修改监听的事件
+    void RemoveConnection(int fd);                                           // 注销连接，释放循环持有的引用
+
+private:
+    int m_epollfd;                  // epoll 句柄
+    int m_wakeupfd;                 // eventfd，用于唤醒阻塞在 epoll_wait 上的循环线程
+    std::atomic<bool> m_quit;       // 退出标志
+    std::thread m_thread;           // 循环线程
+    std::atomic<std::thread::id> m_threadId; // 循环线程id，由循环线程自己在处理任何任务之前写入
+
+    std::mutex m_mutex;             // 保护 m_tasks
+    std::vector<Task> m_tasks;      // 其他线程投递过来的任务
+
+    std::unordered_map<int, std::shared_ptr<KrpcConnection>> m_conns; // fd -> 注册在本循环上的连接
+
+    void Loop();            // 循环线程的主函数
+    void Wakeup();          // 唤醒循环线程
+    void DoPendingTasks();  // 执行任务队列中的任务
+
+    KrpcClientLoop(const KrpcClientLoop&) = delete;
+    KrpcClientLoop& operator=(const KrpcClientLoop&) = delete;
+};
+
+
+
+// 相关配置项：client_io_threads        客户端 I/O 线程数（事件循环个数），默认 2
+//            client_callback_threads  执行异步调用完成回调的工作线程数，默认 0，即直接在 I/O 线程中执行回调
+class KrpcClientLoopPool
+{
+public:
+    static KrpcClientLoopPool& GetInstance();
+    ~KrpcClientLoopPool();
+
+    // 轮询选出一个事件循环
+    KrpcClientLoop* GetNextLoop();
+
+    // 执行异步调用完成回调的执行器（任务窃取调度器），未配置 client_callback_threads 时为空
+    KrpcExecutor* CallbackExecutor() const { return m_callbackExecutor.get(); }
+
+private:
+    std::vector<std::unique_ptr<KrpcClientLoop>> m_loops;
+    std::atomic<uint32_t> m_next;
+    std::unique_ptr<KrpcExecutor> m_callbackExecutor;
+
+    KrpcClientLoopPool();
+
+    KrpcClientLoopPool(const KrpcClientLoopPool&) = delete;
+    KrpcClientLoopPool& operator=(const KrpcClientLoopPool&) = delete;
+};
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <google/protobuf/stubs/callback.h>
+#include <functional>
+#include <utility>
+
+
+// google::protobuf::NewCallback 最多只能绑定两个参数，框架内部需要在回调里携带更多上下文（连接、请求id、请求/响应对象……）
+// KrpcClosure 用 std::function 保存任意可调用对象，Run() 执行一次后自动 delete 自身，语义与 NewCallback 一致
+
+class KrpcClosure : public google::protobuf::Closure
+{
+public:
+    explicit KrpcClosure(std::function<void()> func) : m_func(std::move(func)) {}
+
+    void Run() override
+    {
+        m_func();
+        delete this; // 一次性回调，执行完即释放
+    }
+
+private:
+    std::function<void()> m_func;
+};
@@ -9,6 +9,7 @@ class KrpcConfig
 public:
     void LoadConfigFile(const char* config_file); // 加载配置文件
     std::string Load(const std::string& key); // 查找key对应的value
+    int LoadInt(const std::string& key, int default_value); // 查找key对应的整数value，未配置或非法时返回默认值
 
 private:
     std::unordered_map<std::string, std::string> config_map; // TODO 存什么？？？
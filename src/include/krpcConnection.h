@@ -0,0 +1,226 @@
+#pragma once
+
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/service.h>
+#include "krpcController.h"
+#include "krpcHeader.pb.h"
+#include "krpcIOBuf.h"
+#include "krpcLoadBalancer.h"
+#include "krpcRequestContext.h"
+#include "krpcTimerWheel.h"
+
+#include <google/protobuf/io/coded_stream.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <stdint.h>
+#include <sys/types.h>
+
+class KrpcClientLoop;
+
+// 调用超时时的错误信息
+const char kKrpcCallTimeoutText[] = "rpc call timeout";
+
+// 调用被 KrpcController::StartCancel 取消时的错误信息
+const char kKrpcCallCanceledText[] = "rpc call canceled";
+
+
+// 一次在途的RPC调用，I/O 线程收到对应 request_id 的响应后填充 response 并结束调用：
+//    - 同步调用（done 为空）：调用方线程阻塞在 cv 上，结束时唤醒
+//    - 异步调用（done 非空）：结束时失败原因写入 controller，然后执行 done->Run()
+struct KrpcPendingCall
+{
+    google::protobuf::Message* response = nullptr;          // 调用方提供的响应对象
+    google::protobuf::RpcController* controller = nullptr;  // 异步调用的控制器
+    google::protobuf::Closure* done = nullptr;              // 异步调用的完成回调
+    std::shared_ptr<const KrpcRequestContext> context;      // 发起异步调用时线程上的调用上下文，执行 done 时重新安装
+
+    bool finished = false;      // 调用是否已结束（收到响应或失败）
+    bool failed = false;        // 是否失败
+    krpc::rpcErrorCode errorCode = krpc::RPC_OK; // 失败的类别
+    std::string errText;        // 失败原因
+
+    std::mutex mutex;
+    std::condition_variable cv;
+
+    std::chrono::steady_clock::rep startTime = 0; // 登记时间，收到响应时统计延迟
+    KrpcTimerWheel::Timer timer;        // 调用超时的定时器，挂在全局时间轮上，调用结束时取消
+    uint64_t requestId = 0;             // 登记在 KrpcPendingTable 中时的键
+    KrpcPendingCall* next = nullptr;    // KrpcPendingTable 桶内的链表指针
+};
+
+
+
+// request_id -> 在途调用 的侵入式哈希表：链表指针就放在 KrpcPendingCall 里，登记、取出调用都不需要申请内存
+// 桶数组只在在途调用数超过桶数时翻倍，之后一直保留；不是线程安全的，由 KrpcConnection::m_pendingMutex 保护
+class KrpcPendingTable
+{
+public:
+    KrpcPendingTable();
+
+    void Insert(uint64_t request_id, KrpcPendingCall* call);
+    KrpcPendingCall* Remove(uint64_t request_id);   // 取出对应的调用，没有返回 nullptr
+    KrpcPendingCall* TakeAll();                     // 取出所有调用，用 next 串成链表返回
+    size_t Size() const { return m_count; }
+
+private:
+    static const size_t kInitialBuckets = 64;
+
+    std::vector<KrpcPendingCall*> m_buckets;    // 桶数为 2 的幂
+    size_t m_count;
+
+    void Rehash(size_t buckets);
+};
+
+
+// KrpcConnection 封装客户端到某个服务端 ip:port 的一条 TCP 连接
+// 由 KrpcConnectionPool 统一创建和回收，多个 KrpcChannel / 多个线程共享同一条连接：
+//    - 每个请求带一个连接内唯一的 request_id，发送时整帧加锁写出，不同请求的数据不会交错
+//    - socket 是非阻塞的，注册在某个 KrpcClientLoop 上，由 I/O 线程接收响应、按 request_id 分发，服务端可以乱序返回
+//    - 发送时先在调用方线程直接写，写不完的部分放进发送缓冲区，由 I/O 线程在可写时继续发送
+
+class KrpcConnection : public KrpcCancelable, public std::enable_shared_from_this<KrpcConnection>
+{
+public:
+    KrpcConnection(const std::string& ip, uint16_t port);
+    ~KrpcConnection(); // 析构时关闭socket
+
+    // 建立到服务端的连接，成功后注册到一个 I/O 事件循环上，并与服务端握手取得方法表
+    // connect 最多等待 connect_timeout_ms，握手最多等待 kHandshakeTimeoutMs；budget_ms > 0 时两者合计不超过 budget_ms（调用剩余的时限）
+    bool Connect(int64_t connect_timeout_ms, int64_t budget_ms = 0);
+
+    // 关闭连接：从事件循环上注销，所有在途调用以失败结束
+    void Close();
+
+    // 握手得到的方法编号；服务端没有发布该方法或不支持握手时返回 0，请求改用服务名 + 方法名
+    uint32_t MethodId(const google::protobuf::MethodDescriptor* method) const;
+
+    // 握手协商的帧头版本（见 krpcFrame.h），0 表示 protobuf 帧头
+    uint32_t FrameVersion() const { return m_frameVersion.load(std::memory_order_acquire); }
+
+    // 分配一个连接内唯一的请求id
+    uint64_t NextRequestId() { return m_nextRequestId.fetch_add(1, std::memory_order_relaxed); }
+
+    // 一帧请求放在 KrpcIOBuf 中，各内存块用 sendmsg 一次写出，调用方不需要先拼接成连续内存
+    // 发送后 frame 中的数据被取走：写出的部分直接释放，没写完的部分转移到发送缓冲区，不拷贝数据
+
+    // timeout_ms > 0 时调用的时限，超时后调用以 kKrpcCallTimeoutText 失败结束，之后到达的响应被丢弃；0 表示不限时
+
+    // 同步调用：发送一帧请求并阻塞等待 request_id 对应的响应，响应反序列化到 response 中
+    // 失败时返回 false，并把原因写入 errText、错误码写入 errCode（可以为空）；controller 非空时调用可以通过它的 StartCancel 取消
+    bool Call(uint64_t request_id, KrpcIOBuf* frame, google::protobuf::Message* response, std::string* errText,
+              krpc::rpcErrorCode* errCode, int64_t timeout_ms = 0, KrpcController* controller = nullptr);
+
+    // 异步调用：发送一帧请求后立即返回，调用结束时在 I/O 线程中执行 done->Run()，失败原因和错误码写入 controller
+    // （超时、取消的调用在时间轮线程、取消的线程中执行 done->Run()）；执行 done 时安装发起调用时的 KrpcRequestContext
+    // controller 是 KrpcController 时调用可以通过它的 StartCancel 取消
+    void CallAsync(uint64_t request_id, KrpcIOBuf* frame, google::protobuf::Message* response,
+                   google::protobuf::RpcController* controller, google::protobuf::Closure* done, int64_t timeout_ms = 0);
+
+    // 取消一个在途调用：以 kKrpcCallCanceledText 失败结束，之后到达的响应被丢弃；
+    // notify_server 为 true 时给服务端发取消帧，服务端据此通知正在执行的服务方法。调用已经结束时什么也不做
+    void Cancel(uint64_t request_id, bool notify_server = true) override;
+
+    // 由 KrpcClientLoop 在 I/O 线程中调用，处理 epoll 返回的事件
+    void HandleEvent(uint32_t events);
+
+    // 连接是否已经不可用（对端关闭、读写出错），不可用的连接由连接池移除
+    bool IsBroken() const { return m_broken.load(std::memory_order_acquire); }
+
+    // 当前在途（已发送、未收到响应）的请求数
+    int InFlight() const { return m_inflight.load(std::memory_order_relaxed); }
+
+    // 最近一次收发数据的时间，连接池据此回收空闲连接
+    std::chrono::steady_clock::time_point LastActive() const
+    {
+        return std::chrono::steady_clock::time_point(std::chrono::steady_clock::duration(m_lastActive.load(std::memory_order_relaxed)));
+    }
+
+    const std::string& Ip() const { return m_ip; }
+    uint16_t Port() const { return m_port; }
+
+private:
+    static const size_t kMaxReadBytes = 64 * 1024; // 一次读事件最多读取的字节数
+    static const int64_t kHandshakeTimeoutMs = 3000; // 握手的时限
+
+    int m_fd;                   // 连接对应的sockfd，未连接时为 -1
+    std::string m_ip;           // 服务端 ip
+    uint16_t m_port;            // 服务端 port
+    KrpcClientLoop* m_loop;     // 连接所属的 I/O 事件循环
+
+    std::atomic<uint64_t> m_nextRequestId;  // 下一个请求id
+    std::atomic<bool> m_broken;             // 连接是否已不可用
+    std::atomic<int> m_inflight;            // 在途请求数
+    std::shared_ptr<KrpcEndpointStats> m_stats; // 该服务端的调用统计（所有到该服务端的连接共用），供负载均衡使用
+    std::atomic<std::chrono::steady_clock::rep> m_lastActive; // 最近一次收发数据的时间
+
+    std::mutex m_sendMutex;     // 保护发送缓冲区，保证一帧请求完整写出，多个线程的请求不会交错
+    KrpcIOBuf m_sendBuf;        // 发送缓冲区，保存 socket 暂时写不进去的数据
+    uint32_t m_events;          // 当前在 epoll 上监听的事件，只在 I/O 线程中修改
+    bool m_registered;          // 是否注册在事件循环上，只在 I/O 线程中修改
+
+    std::mutex m_pendingMutex;  // 保护 m_pending
+    KrpcPendingTable m_pending; // request_id -> 等待响应的调用
+
+    // 方法描述 -> 方法编号，在 Connect 中握手时写入，连接交给连接池之后只读，不需要加锁
+    std::unordered_map<const google::protobuf::MethodDescriptor*, uint32_t> m_methodIds;
+    std::atomic<uint32_t> m_frameVersion;   // 握手后由调用方线程写入，I/O 线程按它解析响应帧
+
+    KrpcIOBuf m_recvBuf;        // 接收缓冲区，只在 I/O 线程中访问，大响应直接在内存块链上解析，不需要扩容搬移
+
+    void Touch() { m_lastActive.store(std::chrono::steady_clock::now().time_since_epoch().count(), std::memory_order_relaxed); }
+
+    // 发送握手请求并最多等待 timeout_ms，把服务端的方法表按方法全名对应到本地的方法描述；连接已不可用时返回 false
+    bool Handshake(int64_t timeout_ms);
+
+    // 登记一个在途调用，timeout_ms > 0 时同时在时间轮上加入超时定时器
+    // 连接已不可用时返回 RPC_UNAVAILABLE，controller 已经取消时返回 RPC_CANCELED，这两种情况都不登记
+    krpc::rpcErrorCode AddPending(uint64_t request_id, KrpcPendingCall* call, int64_t timeout_ms, const KrpcController* controller);
+
+    // 从在途调用中取出 request_id 对应的调用并更新计数，没有返回 nullptr（调用方持有 m_pendingMutex）
+    KrpcPendingCall* TakePending(uint64_t request_id);
+
+    // AddPending 之前调用：把调用登记到控制器上供 StartCancel 取消
+    // 登记为在途调用之后，调用随时可能被其他线程结束，异步调用的 done 可能连同控制器一起释放，之后不能再访问控制器；
+    // 登记之前就已经取消的，由 AddPending 在锁内发现，StartCancel 与 AddPending 之间不会漏掉取消
+    void BindCanceler(uint64_t request_id, KrpcController* controller);
+
+    // 时间轮线程中：调用超时，以失败结束（已经收到响应的调用不受影响）
+    static void OnCallTimeout(void* ctx, uint64_t request_id);
+
+    // 用 sendmsg 发送一帧数据（线程安全，不阻塞），没写完的部分转移到发送缓冲区，连接出错返回 false
+    bool Send(KrpcIOBuf* frame);
+
+    // I/O 线程中的事件处理
+    void EnableWriting();   // 发送缓冲区有数据，开始监听可写事件
+    void HandleRead();
+    void HandleWrite();
+    void HandleClose(const std::string& reason);
+
+    // 从 m_recvBuf 中解析出所有完整的响应帧并分发，格式错误返回 false
+    bool DispatchFrames();
+    int DispatchOneFrame(size_t* frame_size);
+
+    // 从输入流中读出响应帧头（返回值含义同 DispatchOneFrame），读完后输入流停在 body 的开头
+    static int ReadResponseHeader(google::protobuf::io::CodedInputStream* input, size_t avail,
+                                  krpc::rpcResponseHeader* header, size_t* frame_size);
+    static int ReadFixedResponseHeader(google::protobuf::io::CodedInputStream* input, size_t avail,
+                                       krpc::rpcResponseHeader* header, size_t* frame_size);
+
+    // 标记连接不可用，并让所有在途调用以 RPC_CONNECTION_LOST 失败结束
+    void MarkBroken(const std::string& reason);
+
+    // 结束一次调用：同步调用唤醒调用方，异步调用执行 done 回调；code 为 RPC_OK 表示成功
+    static void Finish(KrpcPendingCall* call, krpc::rpcErrorCode code, const std::string& errText);
+
+    // 禁止拷贝，一条连接只能被一个对象持有
+    KrpcConnection(const KrpcConnection&) = delete;
+    KrpcConnection& operator=(const KrpcConnection&) = delete;
+};
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "krpcConnection.h"
+#include "krpcExecutor.h"
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+
+/*
+KrpcConnectionPool 是进程内全局唯一的客户端连接池，按服务端 "ip:port" 分组管理连接：
+    - 所有 KrpcChannel 共享连接池，调用时 Acquire 取得一条连接；连接是多路复用的，可以同时被多个调用使用
+    - 优先选择在途请求最少的连接，所有连接都比较忙（在途请求数达到 max_inflight）时才新建连接，连接数不超过 max
+    - 后台线程定期移除已断开的连接、回收空闲超时的连接，并把连接数补足到 min
+
+相关配置项（均可省略，使用默认值）：
+    connpool_min_size           每个服务端保持的最少连接数，默认 0
+    connpool_max_size           每个服务端允许的最大连接数，默认 8
+    connpool_max_inflight       单条连接在途请求数超过该值时尝试新建连接，默认 64
+    connpool_idle_timeout_ms    空闲连接的回收时间，默认 60000
+    connpool_check_interval_ms  后台回收 / 健康检查的周期，默认 5000
+    connpool_wait_timeout_ms    还没有可用连接、且正在建立的连接数已达上限时，调用方的最长等待时间，默认 3000
+    connpool_connect_timeout_ms 建立一条连接时 connect 的最长等待时间（不含握手），默认 3000
+*/
+
+class KrpcConnectionPool
+{
+public:
+    // 获取全局唯一的连接池
+    static KrpcConnectionPool& GetInstance();
+
+    // 取得一条到 ip:port 的可用连接，失败（连接不上或等待超时）返回 nullptr
+    // timeout_ms > 0 时是调用剩余的时限，等待连接、connect 和握手都不超过它；失败时 errCode 给出原因：
+    // 调用的时限用完是 RPC_DEADLINE_EXCEEDED，其他是 RPC_UNAVAILABLE
+    std::shared_ptr<KrpcConnection> Acquire(const std::string& ip, uint16_t port, int64_t timeout_ms = 0,
+                                            krpc::rpcErrorCode* errCode = nullptr);
+
+    // 只取已经建立的连接（在途请求最少的一条），不新建连接、不等待，没有返回 nullptr
+    // 用于不能阻塞的场合，如在时间轮线程中发出对冲的备份请求
+    std::shared_ptr<KrpcConnection> TryAcquire(const std::string& ip, uint16_t port);
+
+    // 可能要建立连接的任务在这里执行：建立连接要同步握手，不能占用客户端 I/O 线程和时间轮线程
+    // 如异步调用的重试、在 I/O 线程中发起而还没有可用连接的异步调用
+    static KrpcExecutor& DialExecutor();
+
+private:
+    // 一个服务端 ip:port 对应的连接组
+    struct Endpoint
+    {
+        std::string ip;
+        uint16_t port;
+        std::vector<std::shared_ptr<KrpcConnection>> conns; // 已建立的连接
+        int connecting = 0;                                 // 正在建立的连接数
+        std::condition_variable cv;                         // 没有可用连接时，调用方在此等待连接建立
+    };
+
+    std::mutex m_mutex; // 保护 m_endpoints 以及每个 Endpoint 的状态
+    std::unordered_map<std::string, std::unique_ptr<Endpoint>> m_endpoints; // "ip:port" -> 连接组
+
+    int m_minSize;
+    int m_maxSize;
+    int m_maxInflight;
+    int m_idleTimeoutMs;
+    int m_checkIntervalMs;
+    int m_waitTimeoutMs;
+    int m_connectTimeoutMs;
+
+    bool m_stop;                        // 通知后台线程退出
+    std::condition_variable m_stopCv;
+    std::thread m_reaper;               // 后台回收 / 健康检查线程
+
+    KrpcConnectionPool();
+    ~KrpcConnectionPool();
+
+    KrpcConnectionPool(const KrpcConnectionPool&) = delete;
+    KrpcConnectionPool& operator=(const KrpcConnectionPool&) = delete;
+
+    // 获取（不存在则创建）ip:port 对应的连接组，调用方需持有 m_mutex
+    Endpoint* GetEndpoint(const std::string& ip, uint16_t port);
+
+    // 从连接组中选出在途请求最少的可用连接，同时移除已断开的连接，调用方需持有 m_mutex
+    std::shared_ptr<KrpcConnection> PickLeastLoaded(Endpoint* ep, std::vector<std::shared_ptr<KrpcConnection>>* broken);
+
+    // 后台线程：定期移除断开的连接、回收空闲连接、补足最少连接数
+    void ReapLoop();
+    void ReapOnce();
+};
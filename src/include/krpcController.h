@@ -1,7 +1,24 @@
 #pragma once
 
 #include <google/protobuf/service.h>
+#include "krpcHeader.pb.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
+#include <stdint.h>
+
+
+// StartCancel 取消的对象：连接上的在途调用（KrpcConnection）或由多个分支组成的对冲调用
+class KrpcCancelable
+{
+public:
+    virtual ~KrpcCancelable() {}
+
+    // 取消 request_id 对应的调用，notify_server 为 true 时通知服务端；调用已经结束时什么也不做
+    virtual void Cancel(uint64_t request_id, bool notify_server) = 0;
+};
 
 
 // RpcController 是用于传递调用状态信息的类，属于客户端和服务端通用接口
@@ -11,22 +28,70 @@ public:
     KrpcController();
 
     // 重置控制器状态
-    void Reaset();
+    void Reset();
 
     // 判断是否发生错误
     bool Failed() const;
 
+    // protobuf 接口要求按值返回错误信息；只是查看时用 ErrorTextRef，不拷贝字符串
     std::string ErrorText() const;
+    const std::string& ErrorTextRef() const { return m_errText; }
 
+    // 服务方法（或调用方自己）设置失败，错误码为 RPC_METHOD_FAILED
     void SetFailed(const std::string& reason);
 
-    // TODO 目前未实现的功能 
-    void StartChannel();     // 开始取消RPC调用
-    bool IsCanceled() const; // 判断RPC调用是否被取消
-    void NotifyOnCancel(google::protobuf::Closure* callback); // 注册取消回调函数
+    // 调用失败的类别，框架设置失败时一并给出：服务端返回的框架错误码，或客户端产生的错误码
+    // （RPC_UNAVAILABLE / RPC_CONNECTION_LOST / RPC_DEADLINE_EXCEEDED / RPC_CANCELED），没有失败时为 RPC_OK
+    void SetFailed(krpc::rpcErrorCode code, const std::string& reason);
+    krpc::rpcErrorCode ErrorCode() const { return m_errorCode; }
+
+    // 框架内部使用：重试前清除上一次尝试的失败状态，其他设置（时限、路由的键、取消）保留
+    void ClearFailed();
+
+    // 一致性哈希路由的键（负载均衡策略为 consistenthash 时使用）：键相同的调用总是发往同一个服务实例
+    // SetRequestKey 按 KrpcHash64 计算键的哈希，已经有整数键时可以直接 SetRequestHash；Reset 后清除
+    void SetRequestKey(const std::string& key);
+    void SetRequestHash(uint64_t hash);
+    bool HasRequestHash() const { return m_hasRequestHash; }
+    uint64_t RequestHash() const { return m_requestHash; }
+
+    // 本次调用的时限（毫秒）：> 0 时超时后调用以失败结束，0 表示不限时；没有设置（-1）时使用 channel 的默认时限
+    // 剩余的时限随请求发给服务端，服务端不会再执行排队期间已经超时的请求；Reset 后恢复为没有设置
+    void SetTimeoutMs(int64_t timeout_ms) { m_timeoutMs = (timeout_ms > 0) ? timeout_ms : 0; }
+    int64_t TimeoutMs() const { return m_timeoutMs; }
+
+    // 取消：
+    //   客户端 StartCancel：正在进行的调用立即以失败结束（同步调用返回，异步调用执行 done），并给服务端发取消帧，
+    //     之后到达的响应被丢弃；调用还没开始时，之后用这个控制器发起的调用直接失败（Reset 后恢复）
+    //   服务端：客户端取消调用或连接断开后 IsCanceled 返回 true，NotifyOnCancel 登记的回调被执行，耗时的服务方法可以据此提前结束
+    //   NotifyOnCancel 的回调只执行一次：请求被取消时执行（在服务端 I/O 线程中，不要做耗时操作），已经取消时立即执行，
+    //   请求没有被取消则在处理结束（done 执行）后执行；到 Reset 时还没有执行的回调在 Reset 中执行
+    void StartCancel();
+    bool IsCanceled() const;
+    void NotifyOnCancel(google::protobuf::Closure* callback);
+
+    // 框架内部使用：登记正在进行的调用，StartCancel 时通过 target 取消这个调用；已经取消时返回 false
+    bool SetCancelTarget(const std::shared_ptr<KrpcCancelable>& target, uint64_t request_id);
+
+    // 框架内部使用：服务端请求处理结束，执行还没有执行的 NotifyOnCancel 回调
+    void RunCancelCallbacks();
 
 
 private:
     bool m_failed;          // rpc方法执行过程中的状态，是否失败
     std::string m_errText;  // rpc方法执行过程中的错误信息
+    krpc::rpcErrorCode m_errorCode; // 失败的类别
+    bool m_hasRequestHash;  // 是否设置了一致性哈希的键
+    uint64_t m_requestHash; // 一致性哈希的键
+    int64_t m_timeoutMs;    // 调用时限，-1 表示没有设置
+
+    std::atomic<bool> m_canceled;   // 是否已经取消，StartCancel 可能在其他线程中调用
+    std::mutex m_cancelMutex;       // 保护以下取消相关的状态
+    std::weak_ptr<KrpcCancelable> m_cancelTarget; // 正在进行的调用所在的连接（或对冲调用）
+    uint64_t m_cancelRequestId;     // 正在进行的调用的请求id
+    std::vector<google::protobuf::Closure*> m_cancelCallbacks; // NotifyOnCancel 登记的回调
 };
+
+
+// 设置调用失败：控制器是 KrpcController 时带上错误码，其他控制器只有错误信息
+void KrpcSetFailed(google::protobuf::RpcController* controller, krpc::rpcErrorCode code, const std::string& reason);
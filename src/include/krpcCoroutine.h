@@ -0,0 +1,273 @@
+#pragma once
+
+// C++20 协程接口，需要 -std=c++20（CMake 中打开 KRPC_BUILD_COROUTINE 后链接 krpc_coro 目标即可）
+#if !defined(__cpp_impl_coroutine)
+#error "krpcCoroutine.h requires C++20 coroutines, link against the krpc_coro target (-DKRPC_BUILD_COROUTINE=ON)"
+#endif
+
+#include "krpcAsyncStub.h"
+#include "krpcLogger.h"
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+
+/*
+协程版本的 RPC 调用，调用方不再为每个在途调用占用一个线程：
+
+    客户端：
+        KrpcCoChannel channel(false);
+        KrpcTask<bool> DoLogin(KrpcCoChannel& channel, kuser::LoginRequest request)
+        {
+            kuser::LoginResponse response = co_await channel.Call<&kuser::UserServiceRpc_Stub::Login>(request);
+            co_return response.success();
+        }
+
+    服务端：服务类继承 KrpcCoService<生成的服务基类>，在方法里把协程交给 Serve()，协程结束时框架自动执行 done 发送响应，
+    协程抛出异常时调用以失败结束，客户端收到异常的说明
+        class UserService : public KrpcCoService<kuser::UserServiceRpc>
+        {
+            void Login(RpcController* cntl, const LoginRequest* req, LoginResponse* resp, Closure* done) override
+            {
+                Serve(cntl, done, DoLogin(req, resp));
+            }
+            KrpcTask<void> DoLogin(const LoginRequest* req, LoginResponse* resp)
+            {
+                auto r = co_await m_downstream.Call<&kuser::UserServiceRpc_Stub::Login>(*req); // 等待下游调用时不占用线程
+                ...
+            }
+        };
+
+    - co_await 一次 RPC 时协程挂起，调用结束后在客户端 I/O 线程中恢复执行；调用失败时 co_await 抛出 KrpcException
+    - 协程恢复后运行在 I/O 线程上，不要在协程里做耗时操作或发起同步调用，否则会阻塞该线程上的所有连接；
+      接着 co_await 的调用需要新建连接时由建立连接的线程发出，不会在 I/O 线程中握手
+      （配置 client_callback_threads 后改为在回调工作线程中恢复）
+    - 被 co_await 的 request 要在 co_await 表达式结束前保持有效（直接 co_await channel.Call<...>(request) 即可满足）
+*/
+
+
+template <typename T = void>
+class KrpcTask;
+
+
+namespace krpc_detail
+{
+
+// 所有 KrpcTask 的 promise 公共部分：惰性启动，结束时恢复等待它的协程
+struct KrpcTaskPromiseBase
+{
+    std::coroutine_handle<> continuation;   // co_await 这个任务的协程
+    std::exception_ptr exception;           // 任务中抛出的异常，在 co_await 处重新抛出
+
+    struct FinalAwaiter
+    {
+        bool await_ready() const noexcept { return false; }
+
+        template <typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+        {
+            std::coroutine_handle<> next = handle.promise().continuation;
+            return next ? next : std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+    FinalAwaiter final_suspend() const noexcept { return {}; }
+    void unhandled_exception() { exception = std::current_exception(); }
+};
+
+
+template <typename T>
+struct KrpcTaskPromise : KrpcTaskPromiseBase
+{
+    std::optional<T> value;
+
+    KrpcTask<T> get_return_object();
+
+    template <typename U>
+    void return_value(U&& v) { value.emplace(std::forward<U>(v)); }
+};
+
+
+template <>
+struct KrpcTaskPromise<void> : KrpcTaskPromiseBase
+{
+    KrpcTask<void> get_return_object();
+    void return_void() const noexcept {}
+};
+
+
+// 不需要等待结果的协程，由 KrpcCoService::Serve 用来启动请求处理协程
+struct KrpcDetachedTask
+{
+    struct promise_type
+    {
+        KrpcDetachedTask get_return_object() const noexcept { return {}; }
+        std::suspend_never initial_suspend() const noexcept { return {}; }
+        std::suspend_never final_suspend() const noexcept { return {}; }
+        void return_void() const noexcept {}
+        void unhandled_exception() const noexcept { std::terminate(); }
+    };
+};
+
+} // namespace krpc_detail
+
+
+
+// 惰性启动的协程任务：创建时不执行，被 co_await 时才开始运行，co_await 的结果为 co_return 的值
+template <typename T>
+class KrpcTask
+{
+public:
+    typedef krpc_detail::KrpcTaskPromise<T> promise_type;
+    typedef std::coroutine_handle<promise_type> Handle;
+
+    explicit KrpcTask(Handle handle) : m_handle(handle) {}
+    KrpcTask(KrpcTask&& other) noexcept : m_handle(std::exchange(other.m_handle, nullptr)) {}
+    ~KrpcTask() { if (m_handle) m_handle.destroy(); }
+
+    class Awaiter
+    {
+    public:
+        explicit Awaiter(Handle handle) : m_handle(handle) {}
+
+        bool await_ready() const noexcept { return !m_handle || m_handle.done(); }
+
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+        {
+            m_handle.promise().continuation = awaiting;
+            return m_handle; // 对称转移：直接开始执行任务
+        }
+
+        T await_resume()
+        {
+            if (m_handle.promise().exception)    std::rethrow_exception(m_handle.promise().exception);
+            if constexpr (!std::is_void<T>::value)
+            {
+                return std::move(*m_handle.promise().value);
+            }
+        }
+
+    private:
+        Handle m_handle;
+    };
+
+    Awaiter operator co_await() && noexcept { return Awaiter(m_handle); }
+
+private:
+    Handle m_handle;
+
+    KrpcTask(const KrpcTask&) = delete;
+    KrpcTask& operator=(const KrpcTask&) = delete;
+};
+
+
+namespace krpc_detail
+{
+
+template <typename T>
+KrpcTask<T> KrpcTaskPromise<T>::get_return_object()
+{
+    return KrpcTask<T>(std::coroutine_handle<KrpcTaskPromise<T>>::from_promise(*this));
+}
+
+inline KrpcTask<void> KrpcTaskPromise<void>::get_return_object()
+{
+    return KrpcTask<void>(std::coroutine_handle<KrpcTaskPromise<void>>::from_promise(*this));
+}
+
+} // namespace krpc_detail
+
+
+
+// co_await 一次 RPC 调用：挂起时通过异步 CallMethod 发出请求，done 回调中恢复协程
+// 控制器和响应对象就放在协程帧里，调用结束前协程帧不会销毁，不需要额外的堆分配
+template <auto Method>
+class KrpcCallAwaiter
+{
+public:
+    typedef KrpcMethodTraits<decltype(Method)> Traits;
+    typedef typename Traits::StubType Stub;
+    typedef typename Traits::Request Request;
+    typedef typename Traits::Response Response;
+
+    KrpcCallAwaiter(google::protobuf::RpcChannel* channel, const Request& request)
+        : m_channel(channel), m_request(&request) {}
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        // done 可能在 I/O 线程中、甚至在 CallMethod 返回前就恢复协程，所以发出调用之后不能再访问本对象
+        Stub stub(m_channel);
+        (stub.*Method)(&m_controller, m_request, &m_response, new KrpcClosure([handle]() { handle.resume(); }));
+    }
+
+    Response await_resume()
+    {
+        if (m_controller.Failed())  throw KrpcException(m_controller.ErrorText());
+        return std::move(m_response);
+    }
+
+private:
+    google::protobuf::RpcChannel* m_channel;
+    const Request* m_request;
+    KrpcController m_controller;
+    Response m_response;
+};
+
+
+
+// 支持 co_await 的 channel：co_await channel.Call<&Stub::Method>(request)
+class KrpcCoChannel : public KrpcChannel
+{
+public:
+    using KrpcChannel::KrpcChannel;
+
+    template <auto Method>
+    KrpcCallAwaiter<Method> Call(const typename KrpcMethodTraits<decltype(Method)>::Request& request)
+    {
+        return KrpcCallAwaiter<Method>(this, request);
+    }
+};
+
+
+
+// 协程版本的服务基类：ServiceBase 为 protoc 生成的服务类（如 kuser::UserServiceRpc）
+// 服务方法中调用 Serve(controller, done, task)，协程在当前线程开始执行，遇到 co_await 挂起后立即返回，
+// 不会占住 KrpcProvider 的 I/O 线程；协程结束时执行 done，由框架发送响应
+// 协程抛出异常时先 controller->SetFailed(异常的说明)，框架回复 RPC_METHOD_FAILED，客户端不会把写了一半的响应当作成功
+template <typename ServiceBase>
+class KrpcCoService : public ServiceBase
+{
+protected:
+    void Serve(google::protobuf::RpcController* controller, google::protobuf::Closure* done, KrpcTask<void> task)
+    {
+        Run(controller, done, std::move(task));
+    }
+
+private:
+    static krpc_detail::KrpcDetachedTask Run(google::protobuf::RpcController* controller, google::protobuf::Closure* done, KrpcTask<void> task)
+    {
+        try
+        {
+            co_await std::move(task);
+        }
+        catch (const std::exception& e)
+        {
+            LOG(ERROR) << "rpc handler coroutine failed: " << e.what();
+            controller->SetFailed(e.what());
+        }
+        catch (...)
+        {
+            LOG(ERROR) << "rpc handler coroutine failed: unknown exception";
+            controller->SetFailed("rpc handler coroutine failed: unknown exception");
+        }
+        done->Run();
+    }
+};
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <functional>
+
+
+// 任务执行器接口：服务端执行服务方法、客户端执行异步调用的完成回调都通过它投递任务
+// 实现：KrpcThreadPool（单个共享无锁队列）、KrpcWorkStealingExecutor（每个线程一个本地队列 + 任务窃取）
+class KrpcExecutor
+{
+public:
+    typedef std::function<void()> Task;
+
+    virtual ~KrpcExecutor() {}
+
+    // 投递任务（线程安全），执行器已满无法接收时返回 false，由调用方决定拒绝还是就地执行
+    virtual bool Submit(Task task) = 0;
+};
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <google/protobuf/message_lite.h>
+#include "krpcIOBuf.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+// 帧有两种格式，连接建立时通过握手协商（见 krpcHeader.proto 中的 rpcHandshakeRequest）：
+//
+//   protobuf 帧头（版本 0，默认 / 兼容旧版本）：【header长度(varint)】+【header（rpcHeader / rpcResponseHeader）】+【body】
+//
+//   固定帧头（版本 1）：【28 字节定长帧头（小端）】+【meta】+【body】
+//        0        4         5       6            8           12           20            24            28
+//        | magic  | version | flags | error_code | method_id | request_id | body_length | meta_length |
+//     - 解码只需要几次定长读取，不需要 protobuf 解析，也不拷贝字符串
+//     - meta 是可选的 protobuf 帧头（请求为 rpcHeader，响应为 rpcResponseHeader），只在定长字段放不下时携带，
+//       例如没有方法编号时的服务名 + 方法名、出错时的错误信息
+//
+// 客户端（KrpcChannel）和服务端（KrpcProvider）都用这里的函数组帧、解析帧头，直接序列化到 KrpcIOBuf 的内存块里
+
+// 握手请求使用的保留服务名（见 krpcHeader.proto 中的 rpcHandshakeRequest）
+const char kKrpcHandshakeService[] = "krpc.Handshake";
+
+// 取消请求使用的保留服务名：rpcHeader.request_id 为要取消的请求，没有参数，服务端不回复
+const char kKrpcCancelService[] = "krpc.Cancel";
+
+const uint32_t kKrpcFrameMagic = 0x4350524B;    // "KRPC"（小端）
+const uint32_t kKrpcFrameVersion = 1;           // 当前支持的固定帧头版本
+const size_t kKrpcFixedHeaderSize = 28;
+const uint8_t kKrpcFlagResponse = 0x01;         // 响应帧
+const uint8_t kKrpcFlagCancel = 0x02;           // 取消帧：request_id 为要取消的请求，没有 meta 和 body，服务端不回复
+
+// 固定帧头中除 magic、version 以外的字段
+struct KrpcFixedHeader
+{
+    uint8_t flags = 0;
+    uint16_t error_code = 0;    // 响应的框架错误码（krpc::rpcErrorCode），请求为 0
+    uint32_t method_id = 0;     // 握手得到的方法编号，0 表示服务名 + 方法名放在 meta 中
+    uint64_t request_id = 0;
+    uint32_t body_length = 0;
+    uint32_t meta_length = 0;
+};
+
+// 把 kKrpcFixedHeaderSize 字节的帧头写入 out
+void KrpcEncodeFixedHeader(const KrpcFixedHeader& header, char* out);
+
+// 从 kKrpcFixedHeaderSize 字节的数据中解析帧头，magic 或版本不对返回 false
+bool KrpcDecodeFixedHeader(const char* data, KrpcFixedHeader* header);
+
+
+// 把一帧追加到 out 末尾。header 中记录的 body 长度必须已经通过 body->ByteSizeLong() 计算好（会被缓存并直接使用）
+// body 为空表示这一帧没有 body；序列化失败返回 false
+bool KrpcSerializeFrame(const google::protobuf::MessageLite& header, const google::protobuf::MessageLite* body, KrpcIOBuf* out);
+
+// 固定帧头格式的版本：meta 为空表示不带 meta（meta_length 由这里计算填写）；body 的要求同上
+bool KrpcSerializeFixedFrame(KrpcFixedHeader header, const google::protobuf::MessageLite* meta,
+                             const google::protobuf::MessageLite* body, KrpcIOBuf* out);
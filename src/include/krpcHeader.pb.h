@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3012000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3012004 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,14 +23,13 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
@@ -43,34 +42,73 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_krpcHeader_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[1]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_krpcHeader_2eproto;
 namespace krpc {
+class rpcHandshakeRequest;
+struct rpcHandshakeRequestDefaultTypeInternal;
+extern rpcHandshakeRequestDefaultTypeInternal _rpcHandshakeRequest_default_instance_;
+class rpcHandshakeResponse;
+struct rpcHandshakeResponseDefaultTypeInternal;
+extern rpcHandshakeResponseDefaultTypeInternal _rpcHandshakeResponse_default_instance_;
 class rpcHeader;
-class rpcHeaderDefaultTypeInternal;
+struct rpcHeaderDefaultTypeInternal;
 extern rpcHeaderDefaultTypeInternal _rpcHeader_default_instance_;
+class rpcResponseHeader;
+struct rpcResponseHeaderDefaultTypeInternal;
+extern rpcResponseHeaderDefaultTypeInternal _rpcResponseHeader_default_instance_;
 }  // namespace krpc
 PROTOBUF_NAMESPACE_OPEN
+template<> ::krpc::rpcHandshakeRequest* Arena::CreateMaybeMessage<::krpc::rpcHandshakeRequest>(Arena*);
+template<> ::krpc::rpcHandshakeResponse* Arena::CreateMaybeMessage<::krpc::rpcHandshakeResponse>(Arena*);
 template<> ::krpc::rpcHeader* Arena::CreateMaybeMessage<::krpc::rpcHeader>(Arena*);
+template<> ::krpc::rpcResponseHeader* Arena::CreateMaybeMessage<::krpc::rpcResponseHeader>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace krpc {
 
+enum rpcErrorCode : int {
+  RPC_OK = 0,
+  RPC_NO_SERVICE = 1,
+  RPC_NO_METHOD = 2,
+  RPC_BAD_REQUEST = 3,
+  RPC_INTERNAL_ERROR = 4,
+  RPC_SERVER_BUSY = 5,
+  RPC_DEADLINE_EXCEEDED = 6,
+  RPC_METHOD_FAILED = 7,
+  RPC_UNAVAILABLE = 8,
+  RPC_CONNECTION_LOST = 9,
+  RPC_CANCELED = 10,
+  rpcErrorCode_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  rpcErrorCode_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool rpcErrorCode_IsValid(int value);
+constexpr rpcErrorCode rpcErrorCode_MIN = RPC_OK;
+constexpr rpcErrorCode rpcErrorCode_MAX = RPC_CANCELED;
+constexpr int rpcErrorCode_ARRAYSIZE = rpcErrorCode_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* rpcErrorCode_descriptor();
+template<typename T>
+inline const std::string& rpcErrorCode_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, rpcErrorCode>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function rpcErrorCode_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    rpcErrorCode_descriptor(), enum_t_value);
+}
+inline bool rpcErrorCode_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, rpcErrorCode* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<rpcErrorCode>(
+    rpcErrorCode_descriptor(), name, value);
+}
 // ===================================================================
 
-class rpcHeader PROTOBUF_FINAL :
+class rpcHeader final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:krpc.rpcHeader) */ {
  public:
-  inline rpcHeader() : rpcHeader(nullptr) {};
-  virtual ~rpcHeader();
+  inline rpcHeader() : rpcHeader(nullptr) {}
+  ~rpcHeader() override;
+  explicit PROTOBUF_CONSTEXPR rpcHeader(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   rpcHeader(const rpcHeader& from);
   rpcHeader(rpcHeader&& from) noexcept
@@ -83,8 +121,13 @@ class rpcHeader PROTOBUF_FINAL :
     return *this;
   }
   inline rpcHeader& operator=(rpcHeader&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -95,14 +138,14 @@ class rpcHeader PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const rpcHeader& default_instance() {
+    return *internal_default_instance();
   }
-  static const rpcHeader& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const rpcHeader* internal_default_instance() {
     return reinterpret_cast<const rpcHeader*>(
                &_rpcHeader_default_instance_);
@@ -115,7 +158,12 @@ class rpcHeader PROTOBUF_FINAL :
   }
   inline void Swap(rpcHeader* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -123,56 +171,53 @@ class rpcHeader PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(rpcHeader* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline rpcHeader* New() const final {
-    return CreateMaybeMessage<rpcHeader>(nullptr);
-  }
-
-  rpcHeader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  rpcHeader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<rpcHeader>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const rpcHeader& from);
-  void MergeFrom(const rpcHeader& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const rpcHeader& from) {
+    rpcHeader::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(rpcHeader* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "krpc.rpcHeader";
   }
   protected:
-  explicit rpcHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit rpcHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_krpcHeader_2eproto);
-    return ::descriptor_table_krpcHeader_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -181,65 +226,93 @@ class rpcHeader PROTOBUF_FINAL :
   enum : int {
     kServiceNameFieldNumber = 1,
     kMethodNameFieldNumber = 2,
+    kRequestIdFieldNumber = 4,
     kArgsSizeFieldNumber = 3,
+    kMethodIdFieldNumber = 5,
+    kTraceIdFieldNumber = 7,
+    kParentSpanIdFieldNumber = 8,
+    kTimeoutMsFieldNumber = 6,
   };
   // bytes service_name = 1;
   void clear_service_name();
   const std::string& service_name() const;
-  void set_service_name(const std::string& value);
-  void set_service_name(std::string&& value);
-  void set_service_name(const char* value);
-  void set_service_name(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_service_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_service_name();
-  std::string* release_service_name();
+  PROTOBUF_NODISCARD std::string* release_service_name();
   void set_allocated_service_name(std::string* service_name);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_service_name();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_service_name(
-      std::string* service_name);
   private:
   const std::string& _internal_service_name() const;
-  void _internal_set_service_name(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_service_name(const std::string& value);
   std::string* _internal_mutable_service_name();
   public:
 
   // bytes method_name = 2;
   void clear_method_name();
   const std::string& method_name() const;
-  void set_method_name(const std::string& value);
-  void set_method_name(std::string&& value);
-  void set_method_name(const char* value);
-  void set_method_name(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_method_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_method_name();
-  std::string* release_method_name();
+  PROTOBUF_NODISCARD std::string* release_method_name();
   void set_allocated_method_name(std::string* method_name);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_method_name();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_method_name(
-      std::string* method_name);
   private:
   const std::string& _internal_method_name() const;
-  void _internal_set_method_name(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_method_name(const std::string& value);
   std::string* _internal_mutable_method_name();
   public:
 
+  // uint64 request_id = 4;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
   // uint32 args_size = 3;
   void clear_args_size();
-  ::PROTOBUF_NAMESPACE_ID::uint32 args_size() const;
-  void set_args_size(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t args_size() const;
+  void set_args_size(uint32_t value);
+  private:
+  uint32_t _internal_args_size() const;
+  void _internal_set_args_size(uint32_t value);
+  public:
+
+  // uint32 method_id = 5;
+  void clear_method_id();
+  uint32_t method_id() const;
+  void set_method_id(uint32_t value);
+  private:
+  uint32_t _internal_method_id() const;
+  void _internal_set_method_id(uint32_t value);
+  public:
+
+  // uint64 trace_id = 7;
+  void clear_trace_id();
+  uint64_t trace_id() const;
+  void set_trace_id(uint64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_args_size() const;
-  void _internal_set_args_size(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint64_t _internal_trace_id() const;
+  void _internal_set_trace_id(uint64_t value);
+  public:
+
+  // uint64 parent_span_id = 8;
+  void clear_parent_span_id();
+  uint64_t parent_span_id() const;
+  void set_parent_span_id(uint64_t value);
+  private:
+  uint64_t _internal_parent_span_id() const;
+  void _internal_set_parent_span_id(uint64_t value);
+  public:
+
+  // uint32 timeout_ms = 6;
+  void clear_timeout_ms();
+  uint32_t timeout_ms() const;
+  void set_timeout_ms(uint32_t value);
+  private:
+  uint32_t _internal_timeout_ms() const;
+  void _internal_set_timeout_ms(uint32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:krpc.rpcHeader)
@@ -249,10 +322,526 @@ class rpcHeader PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr service_name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr method_name_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 args_size_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr service_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr method_name_;
+    uint64_t request_id_;
+    uint32_t args_size_;
+    uint32_t method_id_;
+    uint64_t trace_id_;
+    uint64_t parent_span_id_;
+    uint32_t timeout_ms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_krpcHeader_2eproto;
+};
+// -------------------------------------------------------------------
+
+class rpcResponseHeader final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:krpc.rpcResponseHeader) */ {
+ public:
+  inline rpcResponseHeader() : rpcResponseHeader(nullptr) {}
+  ~rpcResponseHeader() override;
+  explicit PROTOBUF_CONSTEXPR rpcResponseHeader(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  rpcResponseHeader(const rpcResponseHeader& from);
+  rpcResponseHeader(rpcResponseHeader&& from) noexcept
+    : rpcResponseHeader() {
+    *this = ::std::move(from);
+  }
+
+  inline rpcResponseHeader& operator=(const rpcResponseHeader& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline rpcResponseHeader& operator=(rpcResponseHeader&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const rpcResponseHeader& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const rpcResponseHeader* internal_default_instance() {
+    return reinterpret_cast<const rpcResponseHeader*>(
+               &_rpcResponseHeader_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(rpcResponseHeader& a, rpcResponseHeader& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(rpcResponseHeader* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(rpcResponseHeader* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  rpcResponseHeader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<rpcResponseHeader>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const rpcResponseHeader& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const rpcResponseHeader& from) {
+    rpcResponseHeader::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(rpcResponseHeader* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "krpc.rpcResponseHeader";
+  }
+  protected:
+  explicit rpcResponseHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorTextFieldNumber = 4,
+    kRequestIdFieldNumber = 1,
+    kBodySizeFieldNumber = 2,
+    kErrorCodeFieldNumber = 3,
+  };
+  // bytes error_text = 4;
+  void clear_error_text();
+  const std::string& error_text() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_text(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error_text();
+  PROTOBUF_NODISCARD std::string* release_error_text();
+  void set_allocated_error_text(std::string* error_text);
+  private:
+  const std::string& _internal_error_text() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_text(const std::string& value);
+  std::string* _internal_mutable_error_text();
+  public:
+
+  // uint64 request_id = 1;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // uint32 body_size = 2;
+  void clear_body_size();
+  uint32_t body_size() const;
+  void set_body_size(uint32_t value);
+  private:
+  uint32_t _internal_body_size() const;
+  void _internal_set_body_size(uint32_t value);
+  public:
+
+  // .krpc.rpcErrorCode error_code = 3;
+  void clear_error_code();
+  ::krpc::rpcErrorCode error_code() const;
+  void set_error_code(::krpc::rpcErrorCode value);
+  private:
+  ::krpc::rpcErrorCode _internal_error_code() const;
+  void _internal_set_error_code(::krpc::rpcErrorCode value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:krpc.rpcResponseHeader)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_text_;
+    uint64_t request_id_;
+    uint32_t body_size_;
+    int error_code_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_krpcHeader_2eproto;
+};
+// -------------------------------------------------------------------
+
+class rpcHandshakeRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:krpc.rpcHandshakeRequest) */ {
+ public:
+  inline rpcHandshakeRequest() : rpcHandshakeRequest(nullptr) {}
+  ~rpcHandshakeRequest() override;
+  explicit PROTOBUF_CONSTEXPR rpcHandshakeRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  rpcHandshakeRequest(const rpcHandshakeRequest& from);
+  rpcHandshakeRequest(rpcHandshakeRequest&& from) noexcept
+    : rpcHandshakeRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline rpcHandshakeRequest& operator=(const rpcHandshakeRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline rpcHandshakeRequest& operator=(rpcHandshakeRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const rpcHandshakeRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const rpcHandshakeRequest* internal_default_instance() {
+    return reinterpret_cast<const rpcHandshakeRequest*>(
+               &_rpcHandshakeRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(rpcHandshakeRequest& a, rpcHandshakeRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(rpcHandshakeRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(rpcHandshakeRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  rpcHandshakeRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<rpcHandshakeRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const rpcHandshakeRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const rpcHandshakeRequest& from) {
+    rpcHandshakeRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(rpcHandshakeRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "krpc.rpcHandshakeRequest";
+  }
+  protected:
+  explicit rpcHandshakeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMaxFrameVersionFieldNumber = 1,
+  };
+  // uint32 max_frame_version = 1;
+  void clear_max_frame_version();
+  uint32_t max_frame_version() const;
+  void set_max_frame_version(uint32_t value);
+  private:
+  uint32_t _internal_max_frame_version() const;
+  void _internal_set_max_frame_version(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:krpc.rpcHandshakeRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t max_frame_version_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_krpcHeader_2eproto;
+};
+// -------------------------------------------------------------------
+
+class rpcHandshakeResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:krpc.rpcHandshakeResponse) */ {
+ public:
+  inline rpcHandshakeResponse() : rpcHandshakeResponse(nullptr) {}
+  ~rpcHandshakeResponse() override;
+  explicit PROTOBUF_CONSTEXPR rpcHandshakeResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  rpcHandshakeResponse(const rpcHandshakeResponse& from);
+  rpcHandshakeResponse(rpcHandshakeResponse&& from) noexcept
+    : rpcHandshakeResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline rpcHandshakeResponse& operator=(const rpcHandshakeResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline rpcHandshakeResponse& operator=(rpcHandshakeResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const rpcHandshakeResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const rpcHandshakeResponse* internal_default_instance() {
+    return reinterpret_cast<const rpcHandshakeResponse*>(
+               &_rpcHandshakeResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(rpcHandshakeResponse& a, rpcHandshakeResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(rpcHandshakeResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(rpcHandshakeResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  rpcHandshakeResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<rpcHandshakeResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const rpcHandshakeResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const rpcHandshakeResponse& from) {
+    rpcHandshakeResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(rpcHandshakeResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "krpc.rpcHandshakeResponse";
+  }
+  protected:
+  explicit rpcHandshakeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMethodsFieldNumber = 1,
+    kFrameVersionFieldNumber = 2,
+  };
+  // repeated bytes methods = 1;
+  int methods_size() const;
+  private:
+  int _internal_methods_size() const;
+  public:
+  void clear_methods();
+  const std::string& methods(int index) const;
+  std::string* mutable_methods(int index);
+  void set_methods(int index, const std::string& value);
+  void set_methods(int index, std::string&& value);
+  void set_methods(int index, const char* value);
+  void set_methods(int index, const void* value, size_t size);
+  std::string* add_methods();
+  void add_methods(const std::string& value);
+  void add_methods(std::string&& value);
+  void add_methods(const char* value);
+  void add_methods(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& methods() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_methods();
+  private:
+  const std::string& _internal_methods(int index) const;
+  std::string* _internal_add_methods();
+  public:
+
+  // uint32 frame_version = 2;
+  void clear_frame_version();
+  uint32_t frame_version() const;
+  void set_frame_version(uint32_t value);
+  private:
+  uint32_t _internal_frame_version() const;
+  void _internal_set_frame_version(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:krpc.rpcHandshakeResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> methods_;
+    uint32_t frame_version_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_krpcHeader_2eproto;
 };
 // ===================================================================
@@ -268,54 +857,38 @@ class rpcHeader PROTOBUF_FINAL :
 
 // bytes service_name = 1;
 inline void rpcHeader::clear_service_name() {
-  service_name_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.service_name_.ClearToEmpty();
 }
 inline const std::string& rpcHeader::service_name() const {
   // @@protoc_insertion_point(field_get:krpc.rpcHeader.service_name)
   return _internal_service_name();
 }
-inline void rpcHeader::set_service_name(const std::string& value) {
-  _internal_set_service_name(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void rpcHeader::set_service_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.service_name_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:krpc.rpcHeader.service_name)
 }
 inline std::string* rpcHeader::mutable_service_name() {
+  std::string* _s = _internal_mutable_service_name();
   // @@protoc_insertion_point(field_mutable:krpc.rpcHeader.service_name)
-  return _internal_mutable_service_name();
+  return _s;
 }
 inline const std::string& rpcHeader::_internal_service_name() const {
-  return service_name_.Get();
+  return _impl_.service_name_.Get();
 }
 inline void rpcHeader::_internal_set_service_name(const std::string& value) {
   
-  service_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void rpcHeader::set_service_name(std::string&& value) {
-  
-  service_name_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:krpc.rpcHeader.service_name)
-}
-inline void rpcHeader::set_service_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  service_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:krpc.rpcHeader.service_name)
-}
-inline void rpcHeader::set_service_name(const void* value,
-    size_t size) {
-  
-  service_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:krpc.rpcHeader.service_name)
+  _impl_.service_name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* rpcHeader::_internal_mutable_service_name() {
   
-  return service_name_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.service_name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* rpcHeader::release_service_name() {
   // @@protoc_insertion_point(field_release:krpc.rpcHeader.service_name)
-  return service_name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.service_name_.Release();
 }
 inline void rpcHeader::set_allocated_service_name(std::string* service_name) {
   if (service_name != nullptr) {
@@ -323,80 +896,49 @@ inline void rpcHeader::set_allocated_service_name(std::string* service_name) {
   } else {
     
   }
-  service_name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), service_name,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:krpc.rpcHeader.service_name)
-}
-inline std::string* rpcHeader::unsafe_arena_release_service_name() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:krpc.rpcHeader.service_name)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return service_name_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void rpcHeader::unsafe_arena_set_allocated_service_name(
-    std::string* service_name) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (service_name != nullptr) {
-    
-  } else {
-    
+  _impl_.service_name_.SetAllocated(service_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.service_name_.IsDefault()) {
+    _impl_.service_name_.Set("", GetArenaForAllocation());
   }
-  service_name_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      service_name, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:krpc.rpcHeader.service_name)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:krpc.rpcHeader.service_name)
 }
 
 // bytes method_name = 2;
 inline void rpcHeader::clear_method_name() {
-  method_name_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.method_name_.ClearToEmpty();
 }
 inline const std::string& rpcHeader::method_name() const {
   // @@protoc_insertion_point(field_get:krpc.rpcHeader.method_name)
   return _internal_method_name();
 }
-inline void rpcHeader::set_method_name(const std::string& value) {
-  _internal_set_method_name(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void rpcHeader::set_method_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.method_name_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:krpc.rpcHeader.method_name)
 }
 inline std::string* rpcHeader::mutable_method_name() {
+  std::string* _s = _internal_mutable_method_name();
   // @@protoc_insertion_point(field_mutable:krpc.rpcHeader.method_name)
-  return _internal_mutable_method_name();
+  return _s;
 }
 inline const std::string& rpcHeader::_internal_method_name() const {
-  return method_name_.Get();
+  return _impl_.method_name_.Get();
 }
 inline void rpcHeader::_internal_set_method_name(const std::string& value) {
   
-  method_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void rpcHeader::set_method_name(std::string&& value) {
-  
-  method_name_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:krpc.rpcHeader.method_name)
-}
-inline void rpcHeader::set_method_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  method_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:krpc.rpcHeader.method_name)
-}
-inline void rpcHeader::set_method_name(const void* value,
-    size_t size) {
-  
-  method_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:krpc.rpcHeader.method_name)
+  _impl_.method_name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* rpcHeader::_internal_mutable_method_name() {
   
-  return method_name_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.method_name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* rpcHeader::release_method_name() {
   // @@protoc_insertion_point(field_release:krpc.rpcHeader.method_name)
-  return method_name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.method_name_.Release();
 }
 inline void rpcHeader::set_allocated_method_name(std::string* method_name) {
   if (method_name != nullptr) {
@@ -404,58 +946,396 @@ inline void rpcHeader::set_allocated_method_name(std::string* method_name) {
   } else {
     
   }
-  method_name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), method_name,
-      GetArena());
+  _impl_.method_name_.SetAllocated(method_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.method_name_.IsDefault()) {
+    _impl_.method_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:krpc.rpcHeader.method_name)
 }
-inline std::string* rpcHeader::unsafe_arena_release_method_name() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:krpc.rpcHeader.method_name)
-  GOOGLE_DCHECK(GetArena() != nullptr);
+
+// uint32 args_size = 3;
+inline void rpcHeader::clear_args_size() {
+  _impl_.args_size_ = 0u;
+}
+inline uint32_t rpcHeader::_internal_args_size() const {
+  return _impl_.args_size_;
+}
+inline uint32_t rpcHeader::args_size() const {
+  // @@protoc_insertion_point(field_get:krpc.rpcHeader.args_size)
+  return _internal_args_size();
+}
+inline void rpcHeader::_internal_set_args_size(uint32_t value) {
   
-  return method_name_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+  _impl_.args_size_ = value;
 }
-inline void rpcHeader::unsafe_arena_set_allocated_method_name(
-    std::string* method_name) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (method_name != nullptr) {
+inline void rpcHeader::set_args_size(uint32_t value) {
+  _internal_set_args_size(value);
+  // @@protoc_insertion_point(field_set:krpc.rpcHeader.args_size)
+}
+
+// uint64 request_id = 4;
+inline void rpcHeader::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t rpcHeader::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t rpcHeader::request_id() const {
+  // @@protoc_insertion_point(field_get:krpc.rpcHeader.request_id)
+  return _internal_request_id();
+}
+inline void rpcHeader::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void rpcHeader::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:krpc.rpcHeader.request_id)
+}
+
+// uint32 method_id = 5;
+inline void rpcHeader::clear_method_id() {
+  _impl_.method_id_ = 0u;
+}
+inline uint32_t rpcHeader::_internal_method_id() const {
+  return _impl_.method_id_;
+}
+inline uint32_t rpcHeader::method_id() const {
+  // @@protoc_insertion_point(field_get:krpc.rpcHeader.method_id)
+  return _internal_method_id();
+}
+inline void rpcHeader::_internal_set_method_id(uint32_t value) {
+  
+  _impl_.method_id_ = value;
+}
+inline void rpcHeader::set_method_id(uint32_t value) {
+  _internal_set_method_id(value);
+  // @@protoc_insertion_point(field_set:krpc.rpcHeader.method_id)
+}
+
+// uint32 timeout_ms = 6;
+inline void rpcHeader::clear_timeout_ms() {
+  _impl_.timeout_ms_ = 0u;
+}
+inline uint32_t rpcHeader::_internal_timeout_ms() const {
+  return _impl_.timeout_ms_;
+}
+inline uint32_t rpcHeader::timeout_ms() const {
+  // @@protoc_insertion_point(field_get:krpc.rpcHeader.timeout_ms)
+  return _internal_timeout_ms();
+}
+inline void rpcHeader::_internal_set_timeout_ms(uint32_t value) {
+  
+  _impl_.timeout_ms_ = value;
+}
+inline void rpcHeader::set_timeout_ms(uint32_t value) {
+  _internal_set_timeout_ms(value);
+  // @@protoc_insertion_point(field_set:krpc.rpcHeader.timeout_ms)
+}
+
+// uint64 trace_id = 7;
+inline void rpcHeader::clear_trace_id() {
+  _impl_.trace_id_ = uint64_t{0u};
+}
+inline uint64_t rpcHeader::_internal_trace_id() const {
+  return _impl_.trace_id_;
+}
+inline uint64_t rpcHeader::trace_id() const {
+  // @@protoc_insertion_point(field_get:krpc.rpcHeader.trace_id)
+  return _internal_trace_id();
+}
+inline void rpcHeader::_internal_set_trace_id(uint64_t value) {
+  
+  _impl_.trace_id_ = value;
+}
+inline void rpcHeader::set_trace_id(uint64_t value) {
+  _internal_set_trace_id(value);
+  // @@protoc_insertion_point(field_set:krpc.rpcHeader.trace_id)
+}
+
+// uint64 parent_span_id = 8;
+inline void rpcHeader::clear_parent_span_id() {
+  _impl_.parent_span_id_ = uint64_t{0u};
+}
+inline uint64_t rpcHeader::_internal_parent_span_id() const {
+  return _impl_.parent_span_id_;
+}
+inline uint64_t rpcHeader::parent_span_id() const {
+  // @@protoc_insertion_point(field_get:krpc.rpcHeader.parent_span_id)
+  return _internal_parent_span_id();
+}
+inline void rpcHeader::_internal_set_parent_span_id(uint64_t value) {
+  
+  _impl_.parent_span_id_ = value;
+}
+inline void rpcHeader::set_parent_span_id(uint64_t value) {
+  _internal_set_parent_span_id(value);
+  // @@protoc_insertion_point(field_set:krpc.rpcHeader.parent_span_id)
+}
+
+// -------------------------------------------------------------------
+
+// rpcResponseHeader
+
+// uint64 request_id = 1;
+inline void rpcResponseHeader::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t rpcResponseHeader::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t rpcResponseHeader::request_id() const {
+  // @@protoc_insertion_point(field_get:krpc.rpcResponseHeader.request_id)
+  return _internal_request_id();
+}
+inline void rpcResponseHeader::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void rpcResponseHeader::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:krpc.rpcResponseHeader.request_id)
+}
+
+// uint32 body_size = 2;
+inline void rpcResponseHeader::clear_body_size() {
+  _impl_.body_size_ = 0u;
+}
+inline uint32_t rpcResponseHeader::_internal_body_size() const {
+  return _impl_.body_size_;
+}
+inline uint32_t rpcResponseHeader::body_size() const {
+  // @@protoc_insertion_point(field_get:krpc.rpcResponseHeader.body_size)
+  return _internal_body_size();
+}
+inline void rpcResponseHeader::_internal_set_body_size(uint32_t value) {
+  
+  _impl_.body_size_ = value;
+}
+inline void rpcResponseHeader::set_body_size(uint32_t value) {
+  _internal_set_body_size(value);
+  // @@protoc_insertion_point(field_set:krpc.rpcResponseHeader.body_size)
+}
+
+// .krpc.rpcErrorCode error_code = 3;
+inline void rpcResponseHeader::clear_error_code() {
+  _impl_.error_code_ = 0;
+}
+inline ::krpc::rpcErrorCode rpcResponseHeader::_internal_error_code() const {
+  return static_cast< ::krpc::rpcErrorCode >(_impl_.error_code_);
+}
+inline ::krpc::rpcErrorCode rpcResponseHeader::error_code() const {
+  // @@protoc_insertion_point(field_get:krpc.rpcResponseHeader.error_code)
+  return _internal_error_code();
+}
+inline void rpcResponseHeader::_internal_set_error_code(::krpc::rpcErrorCode value) {
+  
+  _impl_.error_code_ = value;
+}
+inline void rpcResponseHeader::set_error_code(::krpc::rpcErrorCode value) {
+  _internal_set_error_code(value);
+  // @@protoc_insertion_point(field_set:krpc.rpcResponseHeader.error_code)
+}
+
+// bytes error_text = 4;
+inline void rpcResponseHeader::clear_error_text() {
+  _impl_.error_text_.ClearToEmpty();
+}
+inline const std::string& rpcResponseHeader::error_text() const {
+  // @@protoc_insertion_point(field_get:krpc.rpcResponseHeader.error_text)
+  return _internal_error_text();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void rpcResponseHeader::set_error_text(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_text_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:krpc.rpcResponseHeader.error_text)
+}
+inline std::string* rpcResponseHeader::mutable_error_text() {
+  std::string* _s = _internal_mutable_error_text();
+  // @@protoc_insertion_point(field_mutable:krpc.rpcResponseHeader.error_text)
+  return _s;
+}
+inline const std::string& rpcResponseHeader::_internal_error_text() const {
+  return _impl_.error_text_.Get();
+}
+inline void rpcResponseHeader::_internal_set_error_text(const std::string& value) {
+  
+  _impl_.error_text_.Set(value, GetArenaForAllocation());
+}
+inline std::string* rpcResponseHeader::_internal_mutable_error_text() {
+  
+  return _impl_.error_text_.Mutable(GetArenaForAllocation());
+}
+inline std::string* rpcResponseHeader::release_error_text() {
+  // @@protoc_insertion_point(field_release:krpc.rpcResponseHeader.error_text)
+  return _impl_.error_text_.Release();
+}
+inline void rpcResponseHeader::set_allocated_error_text(std::string* error_text) {
+  if (error_text != nullptr) {
     
   } else {
     
   }
-  method_name_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      method_name, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:krpc.rpcHeader.method_name)
+  _impl_.error_text_.SetAllocated(error_text, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_text_.IsDefault()) {
+    _impl_.error_text_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:krpc.rpcResponseHeader.error_text)
 }
 
-// uint32 args_size = 3;
-inline void rpcHeader::clear_args_size() {
-  args_size_ = 0u;
+// -------------------------------------------------------------------
+
+// rpcHandshakeRequest
+
+// uint32 max_frame_version = 1;
+inline void rpcHandshakeRequest::clear_max_frame_version() {
+  _impl_.max_frame_version_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 rpcHeader::_internal_args_size() const {
-  return args_size_;
+inline uint32_t rpcHandshakeRequest::_internal_max_frame_version() const {
+  return _impl_.max_frame_version_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 rpcHeader::args_size() const {
-  // @@protoc_insertion_point(field_get:krpc.rpcHeader.args_size)
-  return _internal_args_size();
+inline uint32_t rpcHandshakeRequest::max_frame_version() const {
+  // @@protoc_insertion_point(field_get:krpc.rpcHandshakeRequest.max_frame_version)
+  return _internal_max_frame_version();
 }
-inline void rpcHeader::_internal_set_args_size(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void rpcHandshakeRequest::_internal_set_max_frame_version(uint32_t value) {
   
-  args_size_ = value;
+  _impl_.max_frame_version_ = value;
 }
-inline void rpcHeader::set_args_size(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _internal_set_args_size(value);
-  // @@protoc_insertion_point(field_set:krpc.rpcHeader.args_size)
+inline void rpcHandshakeRequest::set_max_frame_version(uint32_t value) {
+  _internal_set_max_frame_version(value);
+  // @@protoc_insertion_point(field_set:krpc.rpcHandshakeRequest.max_frame_version)
+}
+
+// -------------------------------------------------------------------
+
+// rpcHandshakeResponse
+
+// repeated bytes methods = 1;
+inline int rpcHandshakeResponse::_internal_methods_size() const {
+  return _impl_.methods_.size();
+}
+inline int rpcHandshakeResponse::methods_size() const {
+  return _internal_methods_size();
+}
+inline void rpcHandshakeResponse::clear_methods() {
+  _impl_.methods_.Clear();
+}
+inline std::string* rpcHandshakeResponse::add_methods() {
+  std::string* _s = _internal_add_methods();
+  // @@protoc_insertion_point(field_add_mutable:krpc.rpcHandshakeResponse.methods)
+  return _s;
+}
+inline const std::string& rpcHandshakeResponse::_internal_methods(int index) const {
+  return _impl_.methods_.Get(index);
+}
+inline const std::string& rpcHandshakeResponse::methods(int index) const {
+  // @@protoc_insertion_point(field_get:krpc.rpcHandshakeResponse.methods)
+  return _internal_methods(index);
+}
+inline std::string* rpcHandshakeResponse::mutable_methods(int index) {
+  // @@protoc_insertion_point(field_mutable:krpc.rpcHandshakeResponse.methods)
+  return _impl_.methods_.Mutable(index);
+}
+inline void rpcHandshakeResponse::set_methods(int index, const std::string& value) {
+  _impl_.methods_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:krpc.rpcHandshakeResponse.methods)
+}
+inline void rpcHandshakeResponse::set_methods(int index, std::string&& value) {
+  _impl_.methods_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:krpc.rpcHandshakeResponse.methods)
+}
+inline void rpcHandshakeResponse::set_methods(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.methods_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:krpc.rpcHandshakeResponse.methods)
+}
+inline void rpcHandshakeResponse::set_methods(int index, const void* value, size_t size) {
+  _impl_.methods_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:krpc.rpcHandshakeResponse.methods)
+}
+inline std::string* rpcHandshakeResponse::_internal_add_methods() {
+  return _impl_.methods_.Add();
+}
+inline void rpcHandshakeResponse::add_methods(const std::string& value) {
+  _impl_.methods_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:krpc.rpcHandshakeResponse.methods)
+}
+inline void rpcHandshakeResponse::add_methods(std::string&& value) {
+  _impl_.methods_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:krpc.rpcHandshakeResponse.methods)
+}
+inline void rpcHandshakeResponse::add_methods(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.methods_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:krpc.rpcHandshakeResponse.methods)
+}
+inline void rpcHandshakeResponse::add_methods(const void* value, size_t size) {
+  _impl_.methods_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:krpc.rpcHandshakeResponse.methods)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+rpcHandshakeResponse::methods() const {
+  // @@protoc_insertion_point(field_list:krpc.rpcHandshakeResponse.methods)
+  return _impl_.methods_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+rpcHandshakeResponse::mutable_methods() {
+  // @@protoc_insertion_point(field_mutable_list:krpc.rpcHandshakeResponse.methods)
+  return &_impl_.methods_;
+}
+
+// uint32 frame_version = 2;
+inline void rpcHandshakeResponse::clear_frame_version() {
+  _impl_.frame_version_ = 0u;
+}
+inline uint32_t rpcHandshakeResponse::_internal_frame_version() const {
+  return _impl_.frame_version_;
+}
+inline uint32_t rpcHandshakeResponse::frame_version() const {
+  // @@protoc_insertion_point(field_get:krpc.rpcHandshakeResponse.frame_version)
+  return _internal_frame_version();
+}
+inline void rpcHandshakeResponse::_internal_set_frame_version(uint32_t value) {
+  
+  _impl_.frame_version_ = value;
+}
+inline void rpcHandshakeResponse::set_frame_version(uint32_t value) {
+  _internal_set_frame_version(value);
+  // @@protoc_insertion_point(field_set:krpc.rpcHandshakeResponse.frame_version)
 }
 
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace krpc
 
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::krpc::rpcErrorCode> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::krpc::rpcErrorCode>() {
+  return ::krpc::rpcErrorCode_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
 // @@protoc_insertion_point(global_scope)
 
 #include <google/protobuf/port_undef.inc>
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "krpcTokenBudget.h"
+
+#include <atomic>
+#include <memory>
+#include <stdint.h>
+
+
+/*
+KrpcHedgePolicy 是客户端的对冲（备份请求）策略，每个 KrpcChannel 一个：
+调用发出后超过一段时间还没有结束，就向另一个服务实例再发一份同样的请求，先成功的响应作为结果，另一个分支被取消。
+少数慢实例（GC、磁盘抖动、排队）造成的长尾延迟因此被截断，代价是少量额外的请求
+
+    - 等待时间：配置了固定的时间就用固定的时间，否则用这个 channel 观察到的主请求延迟分位数（默认 p95），
+      样本不够时先不对冲
+    - 预算：每个调用存入 budget_percent / 100 个备份请求的额度，发出备份请求时取出一个，额度不够就不发；
+      备份请求最多占正常请求的 budget_percent%，服务端整体变慢时不会因为对冲而雪上加霜。额度有上限，只允许少量突发
+
+相关配置项（均可省略）：
+    rpcclient_hedge                 1 开启对冲，默认 0 不开启
+    rpcclient_hedge_delay_ms        发出备份请求前的等待时间，默认 0，即按延迟分位数
+    rpcclient_hedge_percentile      按延迟分位数时使用的分位数，默认 95
+    rpcclient_hedge_budget_percent  备份请求占正常请求的比例上限（百分比），默认 5
+*/
+
+class KrpcHedgePolicy
+{
+public:
+    // 按配置创建，没有开启对冲时返回空
+    static std::unique_ptr<KrpcHedgePolicy> Create();
+
+    KrpcHedgePolicy(int64_t delay_ms, int percentile, int budget_percent);
+
+    // 发出备份请求前的等待时间（毫秒），-1 表示暂时不对冲（按分位数对冲、样本还不够）
+    int64_t DelayMs() const;
+
+    // 主请求成功结束，记录从发起调用到收到响应的时间（备份请求的延迟不计入，否则分位数会被对冲本身拉低）
+    void RecordLatency(int64_t latency_us);
+
+    // 每个可以对冲的调用存入额度；发出备份请求前取出额度，额度不够时返回 false
+    void Deposit() { m_budget.Deposit(); }
+    bool Withdraw() { return m_budget.Withdraw(); }
+
+private:
+    static const int kBuckets = 160;                // 对数分桶，每个 2 的幂区间分 4 个桶，覆盖 1us ~ 2^41us
+    static const uint64_t kMinSamples = 100;        // 样本数达到后才按分位数对冲
+    static const uint64_t kRecalcInterval = 64;     // 每记录这么多个样本重新计算一次分位数
+    static const uint64_t kDecayThreshold = 4096;   // 样本数超过后所有桶减半，分位数跟随最近的延迟变化
+
+    int64_t m_delayMs;          // 固定的等待时间，0 表示按分位数
+    int m_percentile;
+    KrpcTokenBudget m_budget;                   // 备份请求的额度，从 0 开始
+
+    std::atomic<uint32_t> m_buckets[kBuckets];  // 各延迟区间的样本数
+    std::atomic<uint64_t> m_samples;            // 记录过的样本总数，决定什么时候重新计算
+    std::atomic<int64_t> m_percentileUs;        // 最近一次算出的分位数（微秒），-1 表示样本还不够
+
+    static int BucketIndex(int64_t latency_us);
+    static int64_t BucketUpperBound(int index);
+
+    void Recalculate();
+};
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <google/protobuf/io/zero_copy_stream.h>
+
+#include <atomic>
+#include <string>
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+
+/*
+KrpcIOBuf 是框架内部传递报文的缓冲区，由若干个引用计数的内存块串成：
+
+    KrpcIOBuf:  [block A: off,len] -> [block B: off,len] -> [block C: off,len]
+                    |                     |
+    另一个 KrpcIOBuf: [block A: off',len'] -> [block B: ...]     （与上面共享同一块内存，只增加引用计数）
+
+    - Append(data)  先写进最后一个内存块的剩余空间（该块没有被共享时），不够再申请新块，已有数据从不搬动
+    - Append(buf) / CutTo / 拷贝构造  只复制块引用并增加引用计数，不拷贝数据，多 MB 的报文也可以随意切分、转发
+    - WriteToSocket / ReadFromFd  直接用 sendmsg / readv 在各个内存块上收发，不需要先拼成连续内存
+    - KrpcIOBufInputStream / KrpcIOBufOutputStream  是 protobuf 的 ZeroCopy 流适配器，消息可以直接从块链上解析、序列化到块链上
+
+    默认大小的内存块释放时放进当前线程的缓存，下次申请直接复用；序列化大消息时新块的大小逐步翻倍（最大 1MB），块数不会太多
+
+    KrpcIOBuf 对象本身不是线程安全的，但不同线程里的 KrpcIOBuf 可以共享同一个内存块（引用计数是原子的，共享的块不会再被写入）
+*/
+
+class KrpcIOBuf
+{
+public:
+    static const size_t kDefaultBlockSize = 8192;       // 默认内存块大小，线程缓存只缓存这个大小的块
+    static const size_t kMaxBlockSize = 1024 * 1024;    // 序列化大消息时单个内存块的最大大小
+    static const int kMaxIov = 64;                      // 一次 sendmsg 最多发送的内存块数
+
+    KrpcIOBuf() : m_size(0) {}
+    ~KrpcIOBuf() { Clear(); }
+
+    KrpcIOBuf(const KrpcIOBuf& other);              // 共享 other 的所有内存块
+    KrpcIOBuf& operator=(const KrpcIOBuf& other);
+    KrpcIOBuf(KrpcIOBuf&& other) noexcept;
+    KrpcIOBuf& operator=(KrpcIOBuf&& other) noexcept;
+
+    size_t Size() const { return m_size; }
+    bool Empty() const { return m_size == 0; }
+    void Clear();
+
+    // 追加数据（拷贝）
+    void Append(const void* data, size_t len);
+    void Append(const std::string& data) { Append(data.data(), data.size()); }
+
+    // 追加另一个 KrpcIOBuf 的全部数据（共享内存块，不拷贝）
+    void Append(const KrpcIOBuf& other);
+    void Append(KrpcIOBuf&& other);
+
+    // 把前 n 个字节移到 out 的末尾（共享内存块，不拷贝），返回实际移动的字节数
+    size_t CutTo(KrpcIOBuf* out, size_t n);
+
+    // 丢弃前 n 个字节，返回实际丢弃的字节数
+    size_t PopFront(size_t n);
+
+    // 从第 pos 个字节开始拷贝最多 n 个字节到 dst，返回实际拷贝的字节数
+    size_t CopyTo(void* dst, size_t n, size_t pos = 0) const;
+
+    // 拷贝成连续的字符串，主要用于调试和小数据
+    std::string ToString() const;
+
+    // 按内存块遍历数据（例如逐块交给只接受连续内存的接口）
+    size_t BlockCount() const { return m_refs.Size(); }
+    const char* BlockData(size_t i) const;
+    size_t BlockLength(size_t i) const { return m_refs[i].length; }
+
+    // 用 sendmsg 把开头的数据写入 socket，写出的部分从缓冲区中移除，返回值与 sendmsg 一致，出错时 saved_errno 保存 errno
+    ssize_t WriteToSocket(int fd, int* saved_errno);
+
+    // 用 readv 从 fd 读取最多 max_bytes 字节追加到缓冲区末尾，返回值与 readv 一致，出错时 saved_errno 保存 errno
+    ssize_t ReadFromFd(int fd, size_t max_bytes, int* saved_errno);
+
+private:
+    friend class KrpcIOBufInputStream;
+    friend class KrpcIOBufOutputStream;
+
+    struct Block;
+
+    // 对某个内存块中一段数据的引用
+    struct BlockRef
+    {
+        Block* block;
+        uint32_t offset;
+        uint32_t length;
+    };
+
+    // 块引用的环形队列：前 kInlineRefs 个引用直接存放在对象内部，更多时才在堆上分配，容量只增不减
+    // 小报文通常只有一两个块，组帧、发送都不需要为块引用申请内存；反复追加 / 弹出也不会像 std::deque 那样周期性地申请释放
+    class BlockRefQueue
+    {
+    public:
+        static const size_t kInlineRefs = 4;
+
+        BlockRefQueue() : m_data(m_inline), m_capacity(kInlineRefs), m_head(0), m_count(0) {}
+        ~BlockRefQueue() { if (m_data != m_inline) delete[] m_data; }
+        BlockRefQueue(const BlockRefQueue& other);
+
+        size_t Size() const { return m_count; }
+        bool Empty() const { return m_count == 0; }
+        BlockRef& operator[](size_t i) { return m_data[(m_head + i) & (m_capacity - 1)]; }
+        const BlockRef& operator[](size_t i) const { return m_data[(m_head + i) & (m_capacity - 1)]; }
+        BlockRef& Front() { return m_data[m_head]; }
+        BlockRef& Back() { return (*this)[m_count - 1]; }
+
+        void PushBack(const BlockRef& ref)
+        {
+            if (m_count == m_capacity)  Grow();
+            m_data[(m_head + m_count) & (m_capacity - 1)] = ref;
+            ++m_count;
+        }
+        void PopFront() { m_head = (m_head + 1) & (m_capacity - 1); --m_count; }
+        void Clear() { m_head = 0; m_count = 0; }
+
+        // 接管 other 的所有引用，other 变为空；本队列原来的引用直接丢弃（由调用方先释放）
+        void TakeFrom(BlockRefQueue& other);
+
+    private:
+        BlockRef m_inline[kInlineRefs];
+        BlockRef* m_data;       // m_inline 或堆上的数组，容量为 2 的幂
+        size_t m_capacity;
+        size_t m_head;
+        size_t m_count;
+
+        void Grow();
+
+        BlockRefQueue& operator=(const BlockRefQueue&) = delete;
+    };
+
+    BlockRefQueue m_refs;
+    size_t m_size;  // 所有引用的总长度
+
+    static Block* AllocBlock(size_t capacity);
+    static void AddRef(Block* block);
+    static void Release(Block* block);
+
+    // 末尾可以直接写入的空间：最后一个块没有被共享且数据写到了块的末尾时，块里剩下的空间
+    size_t TailSpace(char** data);
+
+    // 末尾写入了 len 字节（已经写进 TailSpace 返回的空间），更新长度
+    void CommitTail(size_t len);
+};
+
+
+
+// 从 KrpcIOBuf 中读取数据的 protobuf 输入流，读取过程中 buf 不能被修改
+class KrpcIOBufInputStream : public google::protobuf::io::ZeroCopyInputStream
+{
+public:
+    explicit KrpcIOBufInputStream(const KrpcIOBuf& buf) : m_buf(buf), m_index(0), m_offset(0), m_byteCount(0) {}
+
+    bool Next(const void** data, int* size) override;
+    void BackUp(int count) override;
+    bool Skip(int count) override;
+    int64_t ByteCount() const override { return m_byteCount; }
+
+private:
+    const KrpcIOBuf& m_buf;
+    size_t m_index;         // 当前所在的块引用
+    size_t m_offset;        // 当前块引用中已经读过的字节数
+    int64_t m_byteCount;    // 已经读过的总字节数
+};
+
+
+
+// 向 KrpcIOBuf 末尾追加数据的 protobuf 输出流，直接把消息序列化到内存块里
+class KrpcIOBufOutputStream : public google::protobuf::io::ZeroCopyOutputStream
+{
+public:
+    explicit KrpcIOBufOutputStream(KrpcIOBuf* buf) : m_buf(buf), m_byteCount(0) {}
+
+    bool Next(void** data, int* size) override;
+    void BackUp(int count) override;
+    int64_t ByteCount() const override { return m_byteCount; }
+
+private:
+    KrpcIOBuf* m_buf;
+    int64_t m_byteCount;    // 已经交给调用方写入的总字节数
+};
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+class KrpcController;
+
+
+// 一个服务端 ip:port 的调用统计，到该服务端的所有连接共同更新，所有 channel 的负载均衡器共同读取
+struct KrpcEndpointStats
+{
+    std::atomic<int> inflight{0};           // 在途请求数
+    std::atomic<int64_t> ewmaLatencyUs{0};  // 响应延迟的指数加权移动平均（微秒），0 表示还没有样本
+
+    // 收到一个响应，latency_us 为从发出请求到收到响应的时间
+    void Record(int64_t latency_us);
+
+    // 获取 ip:port 对应的统计（不存在则创建），统计对象创建后不会被删除
+    static std::shared_ptr<KrpcEndpointStats> Get(const std::string& ip, uint16_t port);
+};
+
+
+
+// 一个服务提供者实例，对应 zookeeper 上 "/服务名/方法名/ip:port" 临时节点，节点数据为权重
+struct KrpcServiceInstance
+{
+    std::string ip;
+    uint16_t port;
+    int weight;                                 // 权重，加权随机和一致性哈希（虚拟节点数）时使用
+    std::shared_ptr<KrpcEndpointStats> stats;   // 该实例的调用统计
+};
+
+typedef std::vector<KrpcServiceInstance> KrpcServiceInstanceList;
+typedef std::shared_ptr<const KrpcServiceInstanceList> KrpcServiceInstanceListPtr; // 实例列表是只读的，更新时整体替换
+
+const int kKrpcDefaultWeight = 100; // 节点没有写权重（或权重不合法）时的默认权重
+const int kKrpcMaxWeight = 10000;   // 权重上限，节点上写了更大的权重时按上限处理
+
+
+
+/*
+KrpcLoadBalancer 是客户端负载均衡策略，每个 KrpcChannel 一个，每次调用从服务实例列表中选出一个实例：
+    roundrobin      轮询（默认）
+    random          按权重随机
+    leastrequest    在途请求最少
+    p2c             随机选两个实例，取 EWMA 延迟 * (在途请求数 + 1) 较小的一个
+    consistenthash  一致性哈希，按 KrpcController::SetRequestKey 设置的键选择实例，相同的键总是发往同一个实例；
+                    实例上下线时只有大约 1/N 的键换到别的实例上；没有设置键的调用按轮询选择
+
+    配置项 rpcclient_load_balancer 选择策略；Select 可能被多个线程同时调用，实现必须是线程安全的
+*/
+
+class KrpcLoadBalancer
+{
+public:
+    virtual ~KrpcLoadBalancer() {}
+
+    // 从 instances（不为空）中选出一个实例，返回其下标；controller 为本次调用的控制器，不是 KrpcController 时为空
+    virtual size_t Select(const KrpcServiceInstanceListPtr& instances, const KrpcController* controller) = 0;
+
+    // 按名称创建负载均衡器，名称为空或未知时使用轮询
+    static std::unique_ptr<KrpcLoadBalancer> Create(const std::string& name);
+};
+
+
+
+// 64 位哈希（FNV-1a 再做一次混合），结果在不同进程、不同机器上一致，一致性哈希的键和环上的节点都用它计算
+uint64_t KrpcHash64(const void* data, size_t len);
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <stddef.h>
+#include <stdint.h>
+
+
+/*
+KrpcMPMCQueue 是有界的无锁多生产者多消费者队列（Dmitry Vyukov 的 bounded MPMC queue）：
+
+    - 环形数组中每个槽位带一个序号 sequence，生产者 / 消费者各自用 CAS 抢占位置，抢到后只操作自己的槽位
+    - 入队、出队都不加锁，也不分配内存，队列满 / 空时立即返回 false，由调用方决定重试还是放弃
+    - 容量向上取整为 2 的幂，下标用位与代替取模
+*/
+
+template <typename T>
+class KrpcMPMCQueue
+{
+public:
+    explicit KrpcMPMCQueue(size_t capacity)
+    {
+        size_t size = 2;
+        while (size < capacity)     size <<= 1;
+        m_mask = size - 1;
+        m_cells.reset(new Cell[size]);
+        for (size_t i = 0; i < size; ++i)
+        {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        m_enqueuePos.store(0, std::memory_order_relaxed);
+        m_dequeuePos.store(0, std::memory_order_relaxed);
+    }
+
+    size_t Capacity() const { return m_mask + 1; }
+
+    // 入队，队列已满时返回 false
+    bool TryPush(T&& value)
+    {
+        Cell* cell;
+        size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            cell = &m_cells[pos & m_mask];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0)
+            {
+                // 槽位空闲，抢占这个位置
+                if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))   break;
+            }
+            else if (diff < 0)
+            {
+                return false; // 槽位上一轮的数据还没被取走，队列满
+            }
+            else
+            {
+                pos = m_enqueuePos.load(std::memory_order_relaxed); // 被其他生产者抢先，重新读取位置
+            }
+        }
+        cell->data = std::move(value);
+        cell->sequence.store(pos + 1, std::memory_order_release); // 通知消费者数据已写好
+        return true;
+    }
+
+    // 出队，队列为空时返回 false
+    bool TryPop(T& value)
+    {
+        Cell* cell;
+        size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            cell = &m_cells[pos & m_mask];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0)
+            {
+                if (m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))   break;
+            }
+            else if (diff < 0)
+            {
+                return false; // 生产者还没写入，队列空
+            }
+            else
+            {
+                pos = m_dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->data);
+        cell->data = T(); // 及时释放槽位中对象持有的资源
+        cell->sequence.store(pos + m_mask + 1, std::memory_order_release); // 槽位留给下一轮的生产者
+        return true;
+    }
+
+private:
+    struct Cell
+    {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+
+    static const size_t kCacheLineSize = 64;
+
+    // 生产者和消费者的位置用填充隔开放在不同的缓存行，避免伪共享
+    // （不用 alignas：c++11 的 new 不保证超过 16 字节的对齐）
+    std::unique_ptr<Cell[]> m_cells;
+    size_t m_mask;
+    char m_pad0[kCacheLineSize];
+    std::atomic<size_t> m_enqueuePos;
+    char m_pad1[kCacheLineSize - sizeof(std::atomic<size_t>)];
+    std::atomic<size_t> m_dequeuePos;
+    char m_pad2[kCacheLineSize - sizeof(std::atomic<size_t>)];
+
+    KrpcMPMCQueue(const KrpcMPMCQueue&) = delete;
+    KrpcMPMCQueue& operator=(const KrpcMPMCQueue&) = delete;
+};
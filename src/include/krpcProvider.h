@@ -2,15 +2,23 @@
 
 #include "google/protobuf/service.h"
 #include "zookeeperutil.h"
+#include "krpcHeader.pb.h"
+#include "krpcController.h"
+#include "krpcExecutor.h"
+#include "krpcIOBuf.h"
 
 #include <muduo/net/TcpServer.h>
 #include <muduo/net/EventLoop.h>
 #include <muduo/net/InetAddress.h>
 #include <muduo/net/TcpConnection.h>
 #include <google/protobuf/descriptor.h>
+#include <atomic>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 
 class KrpcProvider
@@ -24,7 +32,7 @@ public:
     void Run();
 
 private:
-    muduo::net::EventLoop event_loop;
+    muduo::net::EventLoop event_loop; // 主 Reactor，只负责 accept 新连接；连接的读写由 TcpServer 内部的子 Reactor 线程池处理
     struct ServiseInfo
     {
         google::protobuf::Service* service;
@@ -33,7 +41,73 @@ private:
 
     std::unordered_map<std::string, ServiseInfo> service_map; // 保存服务对象和RPC方法
 
+    struct MethodEntry
+    {
+        google::protobuf::Service* service;
+        const google::protobuf::MethodDescriptor* method;
+    };
+
+    std::vector<MethodEntry> method_table;          // 方法编号 - 1 -> 服务对象 + 方法描述，按发布顺序编号，握手时告诉客户端
+    krpc::rpcHandshakeResponse handshake_response;  // 握手回复中的方法表，Run 中生成，之后只读
+    uint32_t max_frame_version = 0;                 // 允许协商的固定帧头最高版本，0 表示只使用 protobuf 帧头
+
+    // 从请求帧中解析出的信息，两种帧头格式解析的结果相同
+    struct RequestFrame
+    {
+        uint64_t request_id = 0;
+        uint32_t method_id = 0;
+        krpc::rpcHeader header;         // protobuf 帧头；固定帧头时为附带的 meta（没有 meta 时为空）
+        const char* args_data = nullptr;
+        int args_size = 0;
+        size_t frame_size = 0;          // 整帧长度
+        bool cancel = false;            // 取消帧，request_id 为要取消的请求
+    };
+
+    // 每条连接的状态，连接建立时创建，保存在 TcpConnection 的 context 中
+    struct ConnectionState
+    {
+        std::atomic<uint32_t> frame_version{0};  // 协商好的帧头版本，0 表示 protobuf 帧头
+        std::mutex mutex;                        // 保护 active
+        std::unordered_map<uint64_t, std::shared_ptr<KrpcController>> active; // 请求id -> 正在处理的请求的控制器
+    };
+
+    std::unique_ptr<KrpcExecutor> worker_pool; // 业务线程池，为空时服务方法直接在 I/O 线程中执行
+
+    // 连接建立 / 断开的回调
     void OnConnection(const muduo::net::TcpConnectionPtr& conn);
+
+    // 收到数据的回调：拆出完整的请求帧，反序列化后调用对应的服务方法
     void OnMessage(const muduo::net::TcpConnectionPtr& conn, muduo::net::Buffer* buffer, muduo::Timestamp receive_time);
-    void SendRpcResponse(const muduo::net::TcpConnectionPtr& conn, google::protobuf::Message* response);
+
+    // 服务方法执行完后由 done 回调调用：序列化响应，带上请求id发回客户端
+    void SendRpcResponse(const muduo::net::TcpConnectionPtr& conn, uint64_t request_id, google::protobuf::Message* response);
+
+    // 调用无法完成时（服务/方法不存在、请求解析失败等），给客户端回一个只带错误码的响应
+    void SendRpcError(const muduo::net::TcpConnectionPtr& conn, uint64_t request_id, krpc::rpcErrorCode error_code, const std::string& error_text);
+
+    // 解析 buffer 开头的一帧请求：返回 1 表示完整的一帧，0 表示数据不够，-1 表示格式错误
+    static int ParseRequestFrame(const char* data, size_t len, RequestFrame* frame);       // protobuf 帧头
+    static int ParseFixedRequestFrame(const char* data, size_t len, RequestFrame* frame);  // 固定帧头
+
+    static ConnectionState* State(const muduo::net::TcpConnectionPtr& conn);
+
+    // 连接协商好的帧头版本，0 表示 protobuf 帧头
+    static uint32_t FrameVersion(const muduo::net::TcpConnectionPtr& conn);
+
+    // 收到取消帧（在 I/O 线程中调用）：通知正在处理的请求的控制器，请求已经处理完时什么也不做
+    static void HandleCancel(const muduo::net::TcpConnectionPtr& conn, uint64_t request_id);
+
+    // 请求处理结束（或没有执行），从连接上注销请求的控制器
+    static void RemoveActive(const muduo::net::TcpConnectionPtr& conn, uint64_t request_id);
+
+    // 回复握手请求：响应 body 为发布的方法表和选定的帧头版本，回复发出后这条连接切换到新的帧头（在 I/O 线程中调用）
+    void HandleHandshake(const muduo::net::TcpConnectionPtr& conn, const RequestFrame& frame);
+
+    // 按连接的帧头版本组装响应帧并发送：【header长度(varint)】+【rpcResponseHeader】+【body】或【固定帧头】+【meta】+【body】
+    // body 为空表示没有响应数据；body 非空时必须已经调用过 ByteSizeLong()，长度记录在 response_header 中
+    void SendResponseFrame(const muduo::net::TcpConnectionPtr& conn, const krpc::rpcResponseHeader& response_header,
+                           const google::protobuf::Message* body);
+
+    // 在连接所属的 I/O 线程中发送一帧数据
+    static void SendInLoop(const muduo::net::TcpConnectionPtr& conn, const KrpcIOBuf& frame);
 };
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <stdint.h>
+
+
+/*
+KrpcRequestContext 是服务端处理一个请求时的调用上下文，由 KrpcProvider 在执行服务方法前安装到当前线程：
+    - 截止时间：请求头中剩余的时限换算成本地时刻，请求没有时限时不设置
+    - 链路信息：trace_id 标识整条调用链（请求没有带时由收到请求的服务端生成），span_id 标识这一次处理，
+      parent_span_id 是发起调用的上游服务端的 span_id
+
+    服务方法中通过 KrpcChannel 发起的调用自动继承当前线程的上下文：
+    - 时限取调用自身的时限和请求剩余时限中较早的一个，剩余时限已经用完时调用直接以超时失败，不再发给下游
+    - 请求头带上 trace_id，并以本次处理的 span_id 作为下游的 parent_span_id
+    异步调用的 done 执行时重新安装发起调用时的上下文，done 里继续发起的调用同样继承；
+    服务方法把工作交给自己的线程时，把 Current() 带过去，在那里用 Scope 安装
+*/
+
+class KrpcRequestContext
+{
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    // timeout_ms 为请求头中剩余的时限，0 表示没有时限；trace_id 为 0 时生成一个新的调用链id
+    KrpcRequestContext(int64_t timeout_ms, uint64_t trace_id, uint64_t parent_span_id);
+
+    bool HasDeadline() const { return m_hasDeadline; }
+    Clock::time_point Deadline() const { return m_deadline; }
+    bool Expired() const { return m_hasDeadline && Clock::now() >= m_deadline; }
+
+    uint64_t TraceId() const { return m_traceId; }
+    uint64_t SpanId() const { return m_spanId; }
+    uint64_t ParentSpanId() const { return m_parentSpanId; }
+
+    // 当前线程安装的上下文，不在处理请求时为空
+    static const std::shared_ptr<const KrpcRequestContext>& Current();
+
+    // 在作用域内把 context 安装为当前线程的上下文，离开作用域时恢复原来的上下文（可以嵌套）
+    class Scope
+    {
+    public:
+        explicit Scope(std::shared_ptr<const KrpcRequestContext> context);
+        ~Scope();
+
+    private:
+        std::shared_ptr<const KrpcRequestContext> m_previous;
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+
+private:
+    bool m_hasDeadline;
+    Clock::time_point m_deadline;   // 请求的截止时间
+    uint64_t m_traceId;
+    uint64_t m_spanId;
+    uint64_t m_parentSpanId;
+};
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <google/protobuf/descriptor.h>
+#include "krpcHeader.pb.h"
+#include "krpcTokenBudget.h"
+
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <stdint.h>
+
+
+/*
+KrpcRetryPolicy 是客户端的重试策略，每个 KrpcChannel 一个：失败的调用在退避一段时间后重新选择实例再试一次，
+服务端重启、实例下线这类短暂的故障对调用方不可见
+
+    - 哪些方法重试：只有配置中列出的方法才重试，其中声明为幂等的方法可以在请求可能已经执行的情况下重试
+    - 哪些失败重试（按 KrpcController::ErrorCode 分类）：
+        RPC_UNAVAILABLE、RPC_SERVER_BUSY   请求没有被执行（没有发出、或服务端拒绝），所有开启重试的方法都重试
+        RPC_CONNECTION_LOST                请求发出后连接断开，服务端可能已经执行，只有幂等的方法重试
+        其他（超时、取消、服务方法失败等）   不重试
+    - 退避：第 n 次重试前等待 [d/2, d]，d = min(backoff_ms * 2^(n-1), max_backoff_ms)，随机抖动避免大量调用同时重试；
+      退避结束时已经超过调用的时限就不再重试
+    - 预算：每个调用存入 budget_percent / 100 次重试的额度，每次重试取出一次，额度不够就不重试；
+      服务端整体不可用时重试最多占正常请求的 budget_percent%，不会因为重试把故障放大。额度一开始是满的，
+      调用量很小时偶尔的重启也能被重试掩盖
+
+相关配置项（均可省略，没有配置 rpcclient_retry_methods 或最多只尝试一次时不重试）：
+    rpcclient_retry_methods          开启重试的方法，逗号分隔的方法全名，如 kuser.UserServiceRpc.Login；
+                                     kuser.UserServiceRpc.* 表示服务的所有方法，* 表示所有方法
+    rpcclient_idempotent_methods     声明为幂等的方法，写法同上（同时需要在 rpcclient_retry_methods 中开启）
+    rpcclient_retry_max_attempts     最多尝试的次数（包括第一次），默认 3
+    rpcclient_retry_backoff_ms       第一次重试前的退避时间，默认 20
+    rpcclient_retry_max_backoff_ms   退避时间的上限，默认 1000
+    rpcclient_retry_budget_percent   重试占正常请求的比例上限（百分比），默认 10
+*/
+
+class KrpcRetryPolicy
+{
+public:
+    // 按配置创建，没有开启重试时返回空
+    static std::unique_ptr<KrpcRetryPolicy> Create();
+
+    KrpcRetryPolicy(const std::string& methods, const std::string& idempotent_methods, int max_attempts,
+                    int64_t backoff_ms, int64_t max_backoff_ms, int budget_percent);
+
+    // 方法是否开启了重试
+    bool Enabled(const google::protobuf::MethodDescriptor* method) const { return m_retryMethods.Match(method); }
+
+    // 失败的类别是否可以重试（见上面的分类）
+    bool Retryable(const google::protobuf::MethodDescriptor* method, krpc::rpcErrorCode code) const;
+
+    int MaxAttempts() const { return m_maxAttempts; }
+
+    // 第 retry 次（从 1 开始）重试前的退避时间（毫秒），带随机抖动
+    int64_t BackoffMs(int retry) const;
+
+    // 每个开启重试的调用存入额度；重试前取出额度，额度不够时返回 false
+    void Deposit() { m_budget.Deposit(); }
+    bool Withdraw() { return m_budget.Withdraw(); }
+
+private:
+    // 方法名单：方法全名、服务全名（服务名.*），或者所有方法（*）
+    class MethodSet
+    {
+    public:
+        explicit MethodSet(const std::string& list);
+        bool Match(const google::protobuf::MethodDescriptor* method) const;
+        bool Empty() const { return !m_all && m_methods.empty() && m_services.empty(); }
+
+    private:
+        bool m_all;
+        std::unordered_set<std::string> m_methods;
+        std::unordered_set<std::string> m_services;
+    };
+
+    MethodSet m_retryMethods;
+    MethodSet m_idempotentMethods;
+    int m_maxAttempts;
+    int64_t m_backoffMs;
+    int64_t m_maxBackoffMs;
+    KrpcTokenBudget m_budget;   // 重试的额度，一开始是满的
+};
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "zookeeperutil.h"
+#include "krpcLoadBalancer.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <stdint.h>
+
+
+/*
+KrpcServiceDiscovery 是进程内唯一的服务发现缓存，所有 KrpcChannel 共用：
+    - 只有一个 zk 会话，首次查询时建立，不再为每个 channel 各建一个会话
+    - 每个服务提供者在 "/服务名/方法名" 下注册一个临时子节点 "ip:port"（节点数据为权重），缓存的是完整的实例列表
+    - 每个方法节点第一次查询时从 zk 读取子节点并设置 watch，之后实例上下线、节点被删除或重新创建时
+      由 zk 的回调线程重新读取并更新缓存，查询不再访问 zk
+    - 兼容旧版本服务端：方法节点没有子节点时，按节点数据 "ip:port" 作为唯一的实例
+    - 缓存内容是一份只读快照，更新时复制出新快照再整体替换，同时递增版本号；
+      查询方在当前线程缓存快照，版本号没变时只需要一次原子读，不加锁
+    - zk 会话过期后 watch 全部失效：清空缓存，下一次查询重新建立会话并重新设置 watch
+
+    channel 记住查询时的版本号，版本号变化后重新查询，实例上下线能及时生效
+*/
+
+class KrpcServiceDiscovery
+{
+public:
+    static KrpcServiceDiscovery& GetInstance();
+
+    // 查询方法节点下的服务实例列表：先查缓存，没有时向 zk 查询并设置 watch；没有可用实例返回 false
+    // 返回的列表是只读的，缓存更新后旧列表仍然有效，直到最后一个引用释放
+    bool Lookup(const std::string& path, std::shared_ptr<const KrpcServiceInstanceList>* instances);
+
+    // 缓存的版本号，任何节点变化后递增，调用方据此判断之前查到的结果是否可能已经过期
+    uint64_t Version() const { return m_version.load(std::memory_order_acquire); }
+
+private:
+    typedef std::shared_ptr<const KrpcServiceInstanceList> InstanceListPtr;
+    typedef std::unordered_map<std::string, InstanceListPtr> Snapshot; // 方法节点路径 -> 实例列表（节点不存在时为空列表）
+
+    KrpcServiceDiscovery();
+    ~KrpcServiceDiscovery();
+
+    // 当前线程缓存的快照，版本号变化时才加锁重新取
+    const std::shared_ptr<const Snapshot>& Current();
+
+    // 确保 zk 会话可用，会话过期时重新建立（调用方持有 m_mutex），返回过期的旧会话，由调用方在释放锁之后关闭
+    std::unique_ptr<ZkClient> EnsureSession();
+
+    // 从 zk 读取方法节点下的实例列表并设置 watch（调用方持有 m_mutex），返回值同 ZkClient::GetChildrenWatch
+    int Fetch(const std::string& path, KrpcServiceInstanceList* instances);
+
+    // 用新的实例列表生成新快照并发布，列表没有变化时不发布（调用方持有 m_mutex）
+    void Publish(const std::string& path, const InstanceListPtr& instances);
+
+    // zk 回调线程中：节点变化后重新读取并重新设置 watch
+    void Refresh(const std::string& path);
+
+    // zk 回调线程中：会话过期，清空缓存
+    void OnSessionExpired();
+
+    static void Watcher(zhandle_t* zh, int type, int state, const char* path, void* watcherCtx);
+
+    std::mutex m_mutex;                         // 保护 m_zk、m_expired、m_snapshot，缓存未命中时对 zk 的查询也在锁内进行
+    std::unique_ptr<ZkClient> m_zk;             // 所有 channel 共用的 zk 会话
+    bool m_expired;                             // 会话已过期，等待下一次查询时重建
+    std::shared_ptr<const Snapshot> m_snapshot; // 当前快照
+    std::atomic<uint64_t> m_version;            // 快照版本号，发布新快照后递增
+
+    static thread_local uint64_t t_version;                         // 当前线程缓存的快照版本号
+    static thread_local std::shared_ptr<const Snapshot> t_snapshot; // 当前线程缓存的快照
+
+    KrpcServiceDiscovery(const KrpcServiceDiscovery&) = delete;
+    KrpcServiceDiscovery& operator=(const KrpcServiceDiscovery&) = delete;
+};
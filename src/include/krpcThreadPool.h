@@ -0,0 +1,47 @@
+#pragma once
+
+#include "krpcExecutor.h"
+#include "krpcMPMCQueue.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+/*
+KrpcThreadPool 是服务端的业务线程池，服务方法在这里执行，不占用 I/O 线程：
+    - I/O 线程把任务投递到无锁队列 KrpcMPMCQueue 中，投递本身不加锁
+    - 工作线程取不到任务时先自旋一小段时间，仍然没有任务才睡眠在条件变量上；
+      投递方只有在有线程睡眠时才去加锁唤醒，高负载下收发任务都不需要进内核
+    - 队列有界，满了 Submit 返回 false，由调用方做过载保护（例如给客户端回“服务繁忙”）
+*/
+
+class KrpcThreadPool : public KrpcExecutor
+{
+public:
+    KrpcThreadPool(int threads, size_t queue_size);
+    ~KrpcThreadPool(); // 执行完队列中剩余的任务后退出所有工作线程
+
+    // 投递任务（线程安全），队列已满返回 false
+    bool Submit(Task task) override;
+
+    size_t ThreadCount() const { return m_threads.size(); }
+
+private:
+    static const int kSpinCount = 128; // 工作线程睡眠前的自旋次数
+
+    KrpcMPMCQueue<Task> m_queue;
+    std::vector<std::thread> m_threads;
+    std::atomic<bool> m_quit;
+
+    std::mutex m_mutex;             // 配合 m_cond 使用
+    std::condition_variable m_cond; // 空闲的工作线程睡眠在这里
+    std::atomic<int> m_sleepers;    // 正在（或准备）睡眠的工作线程数
+
+    void WorkerLoop();
+
+    KrpcThreadPool(const KrpcThreadPool&) = delete;
+    KrpcThreadPool& operator=(const KrpcThreadPool&) = delete;
+};
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <stdint.h>
+
+
+/*
+KrpcTimerWheel 是进程内共享的分层时间轮，所有在途调用的超时都挂在这一个时间轮上，不再每个调用一个定时器：
+
+    level 0:  64 个槽，每槽 1ms          覆盖 64ms
+    level 1:  64 个槽，每槽 64ms         覆盖约 4s
+    level 2:  64 个槽，每槽 4096ms       覆盖约 4.4min
+    level 3:  64 个槽，每槽 262144ms     覆盖约 4.7h（更长的超时按上限处理）
+
+    - 加入、取消都是 O(1)：定时器节点嵌在使用方的对象里（如 KrpcPendingCall），用侵入式链表挂在槽上，不需要申请内存
+    - 后台线程按 1ms 推进，低层转完一圈时把高层对应槽里的定时器重新分配到低层（cascade），到期时执行回调
+    - 没有定时器时线程一直睡眠；否则睡到 level 0 下一个非空槽或下一次 cascade 的时刻
+
+    回调在时间轮线程中执行，时间轮的锁已经释放，回调里可以加入 / 取消定时器，但不要做耗时操作
+*/
+
+class KrpcTimerWheel
+{
+public:
+    // 定时器节点：使用方填好 callback / ctx / arg / owner 后调用 Add；节点在到期或取消之前不能销毁
+    struct Timer
+    {
+        typedef void (*Callback)(void* ctx, uint64_t arg);
+
+        Callback callback = nullptr;
+        void* ctx = nullptr;
+        uint64_t arg = 0;
+        std::shared_ptr<void> owner;    // 持有 ctx 所属的对象，保证回调执行时 ctx 仍然有效（可以为空）
+
+        // 以下由时间轮维护
+        Timer* next = nullptr;
+        Timer** pprev = nullptr;        // 非空表示节点挂在时间轮上
+        uint64_t expire = 0;            // 到期的 tick
+    };
+
+    static KrpcTimerWheel& GetInstance();
+
+    // 加入定时器，timeout_ms 毫秒后执行回调（至少 1ms）
+    void Add(Timer* timer, int64_t timeout_ms);
+
+    // 取消定时器：返回 true 表示取消成功，回调不会再执行；返回 false 表示不在时间轮上（没有加入，或已经到期正在 / 已经执行回调）
+    bool Cancel(Timer* timer);
+
+private:
+    static const int kLevelBits = 6;
+    static const int kLevels = 4;
+    static const uint64_t kSlots = 1 << kLevelBits;
+    static const uint64_t kSlotMask = kSlots - 1;
+    static const uint64_t kMaxTicks = (1ULL << (kLevelBits * kLevels)) - 1; // 最长的超时（tick）
+
+    // 到期的定时器，从节点中取出后在锁外执行回调，执行时不再访问节点
+    struct Expired
+    {
+        Timer::Callback callback;
+        void* ctx;
+        uint64_t arg;
+        std::shared_ptr<void> owner;
+    };
+
+    std::mutex m_mutex;                     // 保护以下所有状态
+    std::condition_variable m_cond;
+    Timer* m_slots[kLevels][kSlots];        // 每个槽是一个单向链表的表头
+    uint64_t m_current;                     // 已经处理到的 tick
+    uint64_t m_wakeTick;                    // 后台线程计划醒来的 tick
+    size_t m_count;                         // 时间轮上的定时器个数
+    bool m_stop;
+    std::vector<Expired> m_expired;         // 本轮到期的定时器，只在后台线程中使用，容量保留
+    std::chrono::steady_clock::time_point m_start;
+    std::thread m_thread;
+
+    KrpcTimerWheel();
+    ~KrpcTimerWheel();
+
+    uint64_t NowTick() const;               // 从 m_start 开始经过的毫秒数
+
+    void Place(Timer* timer);               // 按到期时间把节点挂到对应层的槽上
+    void Unlink(Timer* timer);
+    void Advance();                         // 推进一个 tick：先 cascade，再取出 level 0 当前槽里到期的定时器
+    uint64_t NextWakeTick() const;          // 下一个需要处理的 tick
+
+    void Run();                             // 后台线程
+
+    KrpcTimerWheel(const KrpcTimerWheel&) = delete;
+    KrpcTimerWheel& operator=(const KrpcTimerWheel&) = delete;
+};
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <atomic>
+#include <stdint.h>
+
+
+/*
+KrpcTokenBudget 是重试和对冲共用的额度：正常的调用按比例存入额度，额外发出的请求（重试、备份请求）取出额度，
+额外的请求因此最多占正常请求的 percent%，服务端出问题时不会因为这些请求把故障放大
+
+    - 额度以 1/100 个请求为单位，每次 Deposit 存入 percent，每次 Withdraw 取出 kCost（一个请求）
+    - 额度有上限，最多连续取出 10 次，只允许少量突发
+    - 无锁，多个线程可以同时存取
+*/
+
+class KrpcTokenBudget
+{
+public:
+    // percent 限制在 [0, 100]；full 为 true 时额度一开始是满的，否则从 0 开始
+    KrpcTokenBudget(int percent, bool full);
+
+    void Deposit();
+    // 额度不够一个请求时返回 false
+    bool Withdraw();
+
+private:
+    static const int64_t kCost = 100;               // 一个请求的额度
+    static const int64_t kMaxBudget = 10 * kCost;   // 额度上限
+
+    int m_percent;
+    std::atomic<int64_t> m_budget;  // 剩余的额度
+};
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "krpcExecutor.h"
+#include "krpcMPMCQueue.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <stdint.h>
+
+
+/*
+KrpcWorkStealingDeque 是固定容量的 Chase-Lev 无锁双端队列：
+    - 只有所属的工作线程在底部 Push / Pop（后进先出，刚投递的任务数据还在缓存里）
+    - 其他工作线程从顶部 Steal（先进先出，偷走最早投递的任务），只在争抢最后一个任务时才需要 CAS
+*/
+
+class KrpcWorkStealingDeque
+{
+public:
+    typedef KrpcExecutor::Task Task;
+
+    explicit KrpcWorkStealingDeque(size_t capacity);
+
+    bool Push(Task* task);  // 所属线程调用，队列满返回 false
+    Task* Pop();            // 所属线程调用，队列空返回 nullptr
+    Task* Steal();          // 任意线程调用，队列空或与其他线程争抢失败返回 nullptr
+
+private:
+    std::unique_ptr<std::atomic<Task*>[]> m_slots;
+    int64_t m_mask;
+    std::atomic<int64_t> m_top;     // 窃取端
+    std::atomic<int64_t> m_bottom;  // 所属线程端
+};
+
+
+
+/*
+KrpcWorkStealingExecutor 是任务窃取调度器，高并发下避免所有线程争抢同一个队列：
+
+    - 每个工作线程有自己的本地队列 KrpcWorkStealingDeque 和一个 LIFO 槽位
+    - 工作线程内部投递的任务（如服务方法里发起的异步调用、协程恢复）放进 LIFO 槽位，
+      当前任务结束后马上执行，原来槽位里的任务挪进本地队列；连续执行 LIFO 任务的次数有上限，防止本地队列饿死
+    - 外部线程（I/O 线程）投递的任务放进全局注入队列 KrpcMPMCQueue（无锁）
+    - 工作线程取任务的顺序：LIFO 槽位 -> 本地队列 -> 全局注入队列 -> 从随机选出的其他线程本地队列中窃取
+    - 都取不到时自旋一小段时间再睡眠，投递方只有在有线程睡眠时才加锁唤醒
+
+    LIFO 槽位只能被所属线程取走，如果当前任务执行很久，槽位里的任务要等它结束，因此服务方法里不要长时间阻塞
+*/
+
+class KrpcWorkStealingExecutor : public KrpcExecutor
+{
+public:
+    KrpcWorkStealingExecutor(int threads, size_t queue_size);
+    ~KrpcWorkStealingExecutor(); // 执行完剩余的任务后退出所有工作线程
+
+    bool Submit(Task task) override;
+
+    size_t ThreadCount() const { return m_workers.size(); }
+
+private:
+    static const int kSpinCount = 64;           // 睡眠前的自旋轮数
+    static const int kMaxLifoRuns = 3;          // 连续执行 LIFO 槽位任务的次数上限
+    static const size_t kLocalQueueSize = 256;  // 每个工作线程本地队列的容量，满了放进全局注入队列
+
+    struct Worker
+    {
+        Worker() : deque(kLocalQueueSize), lifo(nullptr), lifoRuns(0), random(0) {}
+
+        KrpcWorkStealingDeque deque;
+        Task* lifo;         // LIFO 槽位，只有所属线程访问
+        int lifoRuns;       // 连续执行 LIFO 任务的次数
+        uint32_t random;    // 选择窃取对象用的随机数状态
+        std::thread thread;
+    };
+
+    static thread_local Worker* t_worker;                       // 当前线程对应的工作线程，非工作线程为空
+    static thread_local KrpcWorkStealingExecutor* t_executor;   // 当前工作线程所属的执行器
+
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    KrpcMPMCQueue<Task*> m_inject;  // 全局注入队列，接收外部线程投递的任务
+    std::atomic<bool> m_quit;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    std::atomic<int> m_sleepers;    // 正在（或准备）睡眠的工作线程数
+
+    void WorkerLoop(Worker* worker);
+    Task* FindTask(Worker* worker); // 按顺序查找下一个要执行的任务
+    Task* StealTask(Worker* worker);
+    void NotifyOne();               // 有线程睡眠时唤醒一个
+
+    KrpcWorkStealingExecutor(const KrpcWorkStealingExecutor&) = delete;
+    KrpcWorkStealingExecutor& operator=(const KrpcWorkStealingExecutor&) = delete;
+};
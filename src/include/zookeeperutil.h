@@ -3,6 +3,7 @@
 #include <semaphore.h> // 提供信号量相关接口
 #include <zookeeper/zookeeper.h>
 #include <string>
+#include <vector>
 
 /*
 zkclient 是 Zookeeper 客户端的封装类，负责：
@@ -30,6 +31,10 @@ public:
     // 获取指定路径节点的数据
     std::string GetData(const char* path);
 
+    // 获取子节点列表并设置 watch：子节点增减或节点被删除时 watcher 回调一次；节点不存在时改为监视节点的创建
+    // 返回 zoo_wget_children 的结果，ZOK 表示成功（子节点名写入 children），ZNONODE 表示节点不存在
+    int GetChildrenWatch(const char* path, watcher_fn watcher, void* watcherCtx, std::vector<std::string>* children);
+
 private:
     zhandle_t* m_zhandle; // zk 的客户端会话句柄，ZkClient 用 zhandle_t* 管理 ZooKeeper 会话
 };
@@ -0,0 +1,86 @@
+#include "krpcArenaPool.h"
+#include "krpcMPMCQueue.h"
+
+#include <new>
+#include <vector>
+
+
+const size_t KrpcArenaPool::kInitialBlockSize;
+const size_t KrpcArenaPool::kMaxLocalArenas;
+const size_t KrpcArenaPool::kMaxGlobalArenas;
+
+
+namespace
+{
+
+// Arena 对象和它的初始内存块放在同一次分配里：[Arena][初始内存块]
+const size_t kArenaHeaderSize = (sizeof(google::protobuf::Arena) + 15) & ~static_cast<size_t>(15);
+
+google::protobuf::Arena* CreateArena()
+{
+    char* mem = static_cast<char*>(::operator new(kArenaHeaderSize + KrpcArenaPool::kInitialBlockSize));
+    return new (mem) google::protobuf::Arena(mem + kArenaHeaderSize, KrpcArenaPool::kInitialBlockSize);
+}
+
+void DestroyArena(google::protobuf::Arena* arena)
+{
+    arena->~Arena(); // 初始内存块属于同一次分配，Arena 析构时不会释放它
+    ::operator delete(static_cast<void*>(arena));
+}
+
+
+// 线程缓存，线程退出时销毁其中的 Arena；缓存析构之后归还的 Arena 直接放进全局队列或销毁
+enum CacheState { kCacheUnused = 0, kCacheAlive = 1, kCacheDestroyed = 2 };
+thread_local int t_cacheState = kCacheUnused;
+
+struct ArenaCache
+{
+    std::vector<google::protobuf::Arena*> arenas;
+
+    ArenaCache() { t_cacheState = kCacheAlive; }
+    ~ArenaCache()
+    {
+        t_cacheState = kCacheDestroyed;
+        for (google::protobuf::Arena* arena : arenas)   DestroyArena(arena);
+    }
+};
+
+thread_local ArenaCache t_arenaCache;
+
+
+KrpcMPMCQueue<google::protobuf::Arena*>& GlobalArenas()
+{
+    static KrpcMPMCQueue<google::protobuf::Arena*>* queue = new KrpcMPMCQueue<google::protobuf::Arena*>(KrpcArenaPool::kMaxGlobalArenas); // 进程退出时不析构
+    return *queue;
+}
+
+} // namespace
+
+
+
+google::protobuf::Arena* KrpcArenaPool::Acquire()
+{
+    google::protobuf::Arena* arena = nullptr;
+    if (t_cacheState != kCacheDestroyed && !t_arenaCache.arenas.empty())
+    {
+        arena = t_arenaCache.arenas.back();
+        t_arenaCache.arenas.pop_back();
+        return arena;
+    }
+    if (GlobalArenas().TryPop(arena))   return arena;
+    return CreateArena();
+}
+
+
+void KrpcArenaPool::Release(google::protobuf::Arena* arena)
+{
+    arena->Reset(); // 析构 Arena 上的消息，释放初始块以外的内存，初始块留给下一次调用
+
+    if (t_cacheState != kCacheDestroyed && t_arenaCache.arenas.size() < kMaxLocalArenas)
+    {
+        t_arenaCache.arenas.push_back(arena);
+        return;
+    }
+    if (GlobalArenas().TryPush(std::move(arena)))   return;
+    DestroyArena(arena);
+}
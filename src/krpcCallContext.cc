@@ -0,0 +1,39 @@
+#include "krpcCallContext.h"
+
+
+namespace
+{
+
+thread_local KrpcCallContext t_context;
+thread_local KrpcController t_controller;
+
+} // namespace
+
+
+
+KrpcController& KrpcCallContext::Controller()
+{
+    t_controller.Reset();
+    return t_controller;
+}
+
+
+
+KrpcCallContext::Scope::Scope() : m_context(&t_context), m_temporary(false)
+{
+    if (m_context->m_inUse)
+    {
+        m_context = new KrpcCallContext();
+        m_temporary = true;
+    }
+    m_context->m_inUse = true;
+    m_context->m_frame.Clear();
+}
+
+
+KrpcCallContext::Scope::~Scope()
+{
+    m_context->m_frame.Clear(); // 发送失败时帧里还有数据，内存块尽快归还
+    m_context->m_inUse = false;
+    if (m_temporary)    delete m_context;
+}
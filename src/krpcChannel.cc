@@ -3,215 +3,797 @@
 #include <sys/socket.h> // socket接口
 #include <sys/types.h>  // socket类型定义
 #include <arpa/inet.h>  // ip 地址与网络字节序的转换函数
+#include <climits>
+#include <chrono>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 
 #include "krpcChannel.h"
 #include "krpcHeader.pb.h"
-#include "zookeeperutil.h"
+#include "krpcServiceDiscovery.h"
 #include "krpcApplication.h"
 #include "krpcController.h"
+#include "krpcHedgePolicy.h"
+#include "krpcRetryPolicy.h"
 #include "krpcLogger.h"
+#include "krpcFrame.h"
+#include "krpcCallContext.h"
+#include "krpcClosure.h"
+#include "krpcRequestContext.h"
+#include "krpcTimerWheel.h"
+#include "krpcClientLoop.h"
+
+// channel 的状态：创建后只有实例列表缓存会变化，由 addrMutex 保护，多个线程可以共用同一个 channel
+// 对冲调用的备份请求、异步调用的重试持有这份状态的 shared_ptr，channel 析构后它们照样可以进行
+struct KrpcChannelState
+{
+    std::mutex addrMutex;
+    KrpcServiceInstanceListPtr instances;           // 从服务发现缓存查到的服务实例列表
+    uint64_t discoveryVersion = 0;                  // 查询实例列表时服务发现缓存的版本号，版本号变化后重新查询
+    std::unique_ptr<KrpcLoadBalancer> balancer;     // 每次调用从实例列表中选出一个实例
+    int64_t timeoutMs = 0;                          // 调用的默认时限（毫秒），0 表示不限时
+    std::unique_ptr<KrpcHedgePolicy> hedge;         // 对冲策略，没有开启时为空
+    std::unique_ptr<KrpcRetryPolicy> retry;         // 重试策略，没有开启时为空
+};
 
-// 全局互斥锁
-std::mutex g_data_mutx;
 
 
 // 构造，支持延迟连接
-KrpcChannel::KrpcChannel(bool connectNow) : m_clientfd(-1), m_idx(0)
+KrpcChannel::KrpcChannel(bool connectNow) : m_state(std::make_shared<KrpcChannelState>())
 {
-    // connectNow - 决定是否在创建对象时，立即连接服务器
+    // 配置项 rpcclient_load_balancer：在服务的多个实例之间选择的策略，见 krpcLoadBalancer.h，默认轮询
+    m_state->balancer = KrpcLoadBalancer::Create(KrpcApplication::GetInstance().GetConfig().Load("rpcclient_load_balancer"));
+
+    // 配置项 rpcclient_timeout_ms：调用的默认时限，KrpcController::SetTimeoutMs 可以为单次调用另外设置，默认 5000，0 表示不限时
+    m_state->timeoutMs = KrpcApplication::GetInstance().GetConfig().LoadInt("rpcclient_timeout_ms", 5000);
+    if (m_state->timeoutMs < 0)     m_state->timeoutMs = 0;
 
-    if (!connectNow)    return; // connectNow为false时，延迟连接，连接将在首次调用RPC时再建立
+    // 对冲（备份请求）和重试默认不开启，配置项见 krpcHedgePolicy.h、krpcRetryPolicy.h
+    m_state->hedge = KrpcHedgePolicy::Create();
+    m_state->retry = KrpcRetryPolicy::Create();
 
-    auto rt = newConnect(m_ip.c_str(), m_port); // connectNow = true 尝试连接服务器，最多重试3次
-    int count = 3;
-    while (!rt && count--)  rt = newConnect(m_ip.c_str(), m_port);
+    // connectNow - 是否在创建对象时立即连接服务器
+    // 连接统一由全局连接池 KrpcConnectionPool 管理，而服务端地址要在首次调用时才能从zookeeper查到，
+    // 所以这里不再自己建立连接，首次调用RPC时再从连接池借出，参数仅为兼容保留
+    (void)connectNow;
 }
 
 
 
-// RPC 调用的核心方法，负责将客户端的请求序列化并发送到服务端，同时接收服务端的响应
-void KrpcChannel::CallMethod(const ::google::protobuf::MethodDescriptor* method, // 调用哪个方法
-                ::google::protobuf::RpcController* controller, // 上下文控制器
-                const ::google::protobuf::Message* request,    // 请求参数
-                ::google::protobuf::Message* response,         // 请求响应
-                ::google::protobuf::Closure* done)             // 回调
+// 调用失败：设置错误信息；异步调用（done 非空）还要执行 done 通知调用方
+static void FailCall(google::protobuf::RpcController* controller, google::protobuf::Closure* done,
+                     krpc::rpcErrorCode code, const std::string& reason)
+{
+    KrpcSetFailed(controller, code, reason);
+    if (done != nullptr)    done->Run();
+}
+
+
+
+// 剩余的时限（毫秒），交给连接的超时定时器，同时写进请求头发给服务端；没有时限时为 0，已经超时返回 false
+static bool RemainingMs(bool has_deadline, std::chrono::steady_clock::time_point deadline, int64_t* timeout_ms)
 {
-    // 检查客户端socket是否建立，如果客户端Socket未初始化
-    if (-1 == m_clientfd)
+    *timeout_ms = 0;
+    if (!has_deadline)  return true;
+
+    int64_t remaining_us = std::chrono::duration_cast<std::chrono::microseconds>(deadline - std::chrono::steady_clock::now()).count();
+    if (remaining_us <= 0)  return false;
+    *timeout_ms = (remaining_us + 999) / 1000; // 向上取整，不会比设置的时限提前超时
+    if (*timeout_ms > UINT32_MAX)   *timeout_ms = UINT32_MAX;
+    return true;
+}
+
+
+
+// 按连接协商的帧格式组装请求帧，请求头和请求帧都取自当前线程的调用上下文，反复调用时复用已有的内存
+// args_size 为已经通过 request->ByteSizeLong() 计算好的参数长度
+static bool SerializeRequest(KrpcConnection* conn, const google::protobuf::MethodDescriptor* method,
+                             const google::protobuf::Message* request, size_t args_size, uint64_t request_id, int64_t timeout_ms,
+                             const KrpcRequestContext* request_context, KrpcCallContext::Scope& context)
+{
+    // 定义RPC请求的头部消息 header: 服务名 + 方法名（或方法编号） + 参数长度 + 请求id
+    krpc::rpcHeader& krpcheader = context->Header();
+    uint32_t method_id = conn->MethodId(method); // 握手后请求头里只带方法编号，不再带服务名和方法名
+    if (method_id != 0)
+    {
+        krpcheader.clear_service_name();
+        krpcheader.clear_method_name();
+    }
+    else
     {
-        // 获取服务对象名和方法名
-        const google::protobuf::ServiceDescriptor* sd = method->service();
-        service_name = sd->name();
-        method_name = method->name();
+        krpcheader.set_service_name(method->service()->name());
+        krpcheader.set_method_name(method->name());
+    }
+    krpcheader.set_timeout_ms(static_cast<uint32_t>(timeout_ms));
+    krpcheader.set_trace_id(request_context != nullptr ? request_context->TraceId() : 0);
+    krpcheader.set_parent_span_id(request_context != nullptr ? request_context->SpanId() : 0);
 
-        // 查询zookeeper，找到提供该服务的服务端ip:port
-        ZkClient zkCli;
-        zkCli.Start(); // TODO 建立与zk集群的连接？？？ 不太理解？？这里连接的是什么？
-        std::string host_data = QueryServiceHost(&zkCli, service_name, method_name, m_idx); // 查询服务地址
-        m_ip = host_data.substr(0, m_idx); // 提取 ip 
-        std::cout << "ip: " << m_ip << std::endl;
-        m_port = atoi(host_data.substr(m_idx + 1, host_data.size() - m_idx).c_str()); // 提取 port 
-        std::cout << "port: " << m_port << std::endl;
 
-        // 尝试连接服务器，返回的是client的sockfd
-        auto rt = newConnect(m_ip.c_str(), m_port);
-        if (!rt)
+    // 完整的RPC请求报文 [header_size][rpc_header][args] 直接序列化到 KrpcIOBuf 的内存块中，
+    // 内存块取自当前线程的缓存，发送完后归还，大请求分散在若干个内存块里，不需要拼成连续内存
+    // 握手协商了固定帧头时为 [固定帧头][meta][args]，有方法编号、不限时且没有调用链时不带 meta，服务端不需要解析 protobuf 帧头
+    KrpcIOBuf& frame = context->Frame();
+    if (conn->FrameVersion() != 0)
+    {
+        KrpcFixedHeader fixed;
+        fixed.method_id = method_id;
+        fixed.request_id = request_id;
+        fixed.body_length = static_cast<uint32_t>(args_size);
+
+        // 定长字段已经在固定帧头里，meta 只带服务名、方法名、时限和调用链
+        krpcheader.clear_method_id();
+        krpcheader.clear_args_size();
+        krpcheader.clear_request_id();
+        bool with_meta = (method_id == 0 || timeout_ms > 0 || krpcheader.trace_id() != 0);
+        return KrpcSerializeFixedFrame(fixed, with_meta ? &krpcheader : nullptr, request, &frame);
+    }
+
+    krpcheader.set_method_id(method_id);
+    krpcheader.set_args_size(static_cast<uint32_t>(args_size));
+    krpcheader.set_request_id(request_id);
+    return KrpcSerializeFrame(krpcheader, request, &frame);
+}
+
+
+
+/*
+对冲调用：同一个请求最多发往两个实例（主分支和备份分支），先成功的分支作为调用的结果，另一个分支被取消
+
+    - 主分支直接把响应写进调用方的 response，备份分支写进自己的 backupResponse；
+      调用方的 response 在主分支结束（成功、失败或被取消）之前一直属于主分支，所以主分支结束后才交付结果，
+      备份分支先成功时先取消主分支，主分支结束后再把备份分支的结果换进调用方的 response
+    - 一个分支失败时如果另一个分支还在进行，等它的结果；所有分支都失败才以失败结束
+    - 分支的完成回调、对冲定时器和调用方的取消（StartCancel）可能在不同线程中同时发生，状态都由 mutex 保护，
+      取消分支、执行 done 都在锁外进行（取消分支会在当前线程中执行该分支的完成回调）
+    - 备份分支在时间轮线程中发出，那时调用方可能已经拿到结果、释放了请求，所以两个分支都从调用自己的请求副本组帧
+*/
+struct KrpcHedgedCall : public KrpcCancelable, public std::enable_shared_from_this<KrpcHedgedCall>
+{
+    // 一个分支：发往某个实例的一份请求
+    struct Leg
+    {
+        std::shared_ptr<KrpcConnection> conn;
+        uint64_t requestId = 0;
+        KrpcController controller;      // 分支自己的控制器，记录失败原因
+        google::protobuf::Message* response = nullptr;
+        bool launched = false;          // 已经发出（或发出前就失败了）
+        bool done = false;              // 已经结束
+    };
+
+    // 调用的参数，创建后只读
+    const google::protobuf::MethodDescriptor* method = nullptr;
+    std::unique_ptr<google::protobuf::Message> request;         // 调用方请求的副本
+    size_t argsSize = 0;
+    google::protobuf::Message* response = nullptr;
+    google::protobuf::RpcController* controller = nullptr;
+    KrpcController route;           // 只带调用方控制器上一致性哈希的键，时间轮线程中选实例用（调用方的控制器那时可能已经不在了）
+    google::protobuf::Closure* done = nullptr;
+    std::shared_ptr<const KrpcRequestContext> requestContext;   // 发起调用时的请求上下文，备份分支在时间轮线程中发出时重新安装
+    KrpcServiceInstanceListPtr instances;
+    size_t primaryIndex = 0;                                    // 主分支的实例
+    std::shared_ptr<KrpcChannelState> state;                    // 负载均衡器和对冲策略，备份分支发出时 channel 可能已经不在了
+    bool hasDeadline = false;
+    std::chrono::steady_clock::time_point deadline;
+    std::chrono::steady_clock::time_point start;
+
+    std::mutex mutex;               // 保护以下状态
+    std::condition_variable cv;     // 同步调用等待结果
+    Leg legs[2];                    // 主分支、备份分支
+    std::unique_ptr<google::protobuf::Message> backupResponse;
+    int winner = -1;                // 先成功的分支，-1 表示还没有
+    bool delivered = false;         // 结果已经确定，不再发出备份请求
+    bool finished = false;          // 同步调用：结果已经写好，可以返回了
+    bool canceled = false;          // 调用方取消了调用
+    bool failed = false;            // 交付的结果是否失败
+    krpc::rpcErrorCode errCode = krpc::RPC_OK;  // 失败的类别和原因（最后一个失败的分支的）
+    std::string errText;
+    KrpcTimerWheel::Timer timer;    // 对冲定时器
+
+    // 发出第 i 个分支，发出前就失败时（超时、序列化失败）直接结束该分支
+    void Launch(int i, const std::shared_ptr<KrpcConnection>& conn)
+    {
+        Leg& leg = legs[i];
+        uint64_t request_id = conn->NextRequestId();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (delivered || canceled)  return;
+            leg.conn = conn;
+            leg.requestId = request_id;
+            leg.response = (i == 0) ? response : backupResponse.get();
+            leg.launched = true;
+        }
+
+        int64_t timeout_ms = 0;
+        KrpcCallContext::Scope context;
+        if (!RemainingMs(hasDeadline, deadline, &timeout_ms))
         {
-            LOG(ERROR) << "connect server error"; // 连接失败，记录错误日志
+            leg.controller.SetFailed(krpc::RPC_DEADLINE_EXCEEDED, kKrpcCallTimeoutText);
+        }
+        else if (!SerializeRequest(conn.get(), method, request.get(), argsSize, request_id, timeout_ms, requestContext.get(), context))
+        {
+            leg.controller.SetFailed(krpc::RPC_BAD_REQUEST, "serialize request fail");
+        }
+        else
+        {
+            std::shared_ptr<KrpcHedgedCall> self = shared_from_this();
+            conn->CallAsync(request_id, &context->Frame(), leg.response, &leg.controller,
+                            new KrpcClosure([self, i]() { self->OnLegDone(i); }), timeout_ms);
             return;
         }
-        else 
+        OnLegDone(i);
+    }
+
+    // 分支结束：第一个成功的分支取消另一个分支；主分支结束后，有分支成功或者所有分支都结束了就交付结果
+    void OnLegDone(int i)
+    {
+        int cancel_leg = -1;
+        bool deliver = false;
+        bool primary_ok = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            Leg& leg = legs[i];
+            leg.done = true;
+            if (leg.controller.Failed())
+            {
+                if (winner < 0)
+                {
+                    errCode = leg.controller.ErrorCode();
+                    errText = leg.controller.ErrorTextRef();
+                }
+            }
+            else if (winner < 0)
+            {
+                primary_ok = (i == 0);
+                winner = i;
+                int other = 1 - i;
+                if (legs[other].launched && !legs[other].done)  cancel_leg = other;
+            }
+
+            bool all_done = legs[0].done && (!legs[1].launched || legs[1].done);
+            if (!delivered && legs[0].done && (winner >= 0 || all_done))
+            {
+                delivered = true;
+                deliver = true;
+            }
+        }
+
+        // 对冲延迟按主分支的延迟计算：备份分支赢了说明主分支慢，这时记录备份分支的延迟会让分位数越来越小
+        if (primary_ok)         state->hedge->RecordLatency(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+        if (cancel_leg >= 0)    legs[cancel_leg].conn->Cancel(legs[cancel_leg].requestId);
+        if (deliver)            Deliver();
+    }
+
+    // 交付结果（只执行一次），此时主分支已经结束，不会再写调用方的 response
+    void Deliver()
+    {
+        KrpcTimerWheel::GetInstance().Cancel(&timer);
+        timer.owner.reset(); // 定时器持有调用本身，不再需要时断开
+        failed = (winner < 0);
+        if (!failed && winner == 1 && legs[0].controller.Failed())
+        {
+            response->GetReflection()->Swap(response, backupResponse.get()); // 备份分支的结果换给调用方
+        }
+
+        if (done != nullptr)
         {
-            LOG(INFO) << "connect server success"; // 连接成功，记录日志
+            if (failed)     KrpcSetFailed(controller, errCode, errText);
+            done->Run();
+            return;
         }
+        std::lock_guard<std::mutex> lock(mutex);
+        finished = true;
+        cv.notify_all();
     }
 
-    // 将请求参数 request 序列化为字符串，并计算其长度
-    uint32_t args_size{};
-    std::string args_str;
-    if (request->SerializeToString(&args_str))  // 序列化请求参数
+    // 调用方取消：取消所有还在进行的分支，不再发出备份请求
+    void Cancel(uint64_t request_id, bool notify_server) override
     {
-        args_size = args_str.size(); // 获取序列化后的长度
+        std::shared_ptr<KrpcConnection> conns[2];
+        uint64_t request_ids[2] = {0, 0};
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            canceled = true;
+            for (int i = 0; i < 2; ++i)
+            {
+                if (legs[i].launched && !legs[i].done)
+                {
+                    conns[i] = legs[i].conn;
+                    request_ids[i] = legs[i].requestId;
+                }
+            }
+        }
+        for (int i = 0; i < 2; ++i)
+        {
+            if (conns[i])   conns[i]->Cancel(request_ids[i], notify_server);
+        }
     }
-    else 
+
+    // 时间轮线程中：主分支迟迟没有结束，在预算允许时向另一个实例发出备份请求
+    // 只使用已经建立的连接，不在时间轮线程中建立连接；选不出实例或预算不够时不对冲，主分支继续
+    // 检查完状态、释放锁之后主分支随时可能交付结果，之后不能再访问调用方的任何对象（控制器、response）
+    static void OnTimer(void* ctx, uint64_t arg)
     {
-        controller->SetFailed("serialize request fail"); // 序列化失败，设置错误信息
+        KrpcHedgedCall* self = static_cast<KrpcHedgedCall*>(ctx);
+        {
+            // 还没有交付时调用方的 response 一定还在，在锁内用它创建备份分支的 response
+            std::lock_guard<std::mutex> lock(self->mutex);
+            if (self->delivered || self->canceled || self->legs[0].done)    return;
+            if (!self->backupResponse)  self->backupResponse.reset(self->response->New());
+        }
+
+        const KrpcServiceInstanceList& list = *self->instances;
+        size_t first = self->state->balancer->Select(self->instances, &self->route);
+        std::shared_ptr<KrpcConnection> conn;
+        for (size_t k = 0; k < list.size() && !conn; ++k)
+        {
+            size_t index = (first + k) % list.size();
+            if (index == self->primaryIndex)    continue;
+            conn = KrpcConnectionPool::GetInstance().TryAcquire(list[index].ip, list[index].port);
+        }
+        if (!conn || !self->state->hedge->Withdraw())    return;
+
+        KrpcRequestContext::Scope scope(self->requestContext); // 备份分支同样带上调用链，done 里继续发起的调用也能继承
+        self->Launch(1, conn);
     }
+};
+
+
+
+// 一次调用的参数，在 CallMethod 开始时确定；重试时每次尝试共用，截止时间从第一次尝试开始计算
+struct KrpcCallArgs
+{
+    const google::protobuf::MethodDescriptor* method = nullptr;
+    google::protobuf::RpcController* controller = nullptr;
+    KrpcController* krpcController = nullptr;   // controller 是 KrpcController 时非空
+    const google::protobuf::Message* request = nullptr;
+    google::protobuf::Message* response = nullptr;
+    google::protobuf::Closure* done = nullptr;
+    std::shared_ptr<const KrpcRequestContext> requestContext;
+    bool hasDeadline = false;
+    std::chrono::steady_clock::time_point deadline;
+};
+
+
 
+// 一次尝试：查询实例、选出实例、取得连接、发出请求（开启对冲时可能发往两个实例）
+static void Attempt(const std::shared_ptr<KrpcChannelState>& state, const KrpcCallArgs& args);
 
-    // 定义RPC请求的头部消息 header: 服务名 + 方法名 + 参数长度
-    krpc::rpcHeader krpcheader;
-    krpcheader.set_service_name(service_name);
-    krpcheader.set_method_name(method_name);
-    krpcheader.set_args_size(args_size);
+// 带重试的调用：同步调用在当前线程中退避、重试，异步调用交给 KrpcRetriedCall
+static void CallWithRetry(const std::shared_ptr<KrpcChannelState>& state, const KrpcCallArgs& args);
 
+// 对冲调用：发出主请求，必要时在时间轮线程中发出备份请求
+static void CallHedged(const std::shared_ptr<KrpcHedgedCall>& call, const KrpcCallArgs& args);
 
-    // RPC头部消息序列化为字符串，并计算其长度
-    uint32_t header_size = 0;
-    std::string rpc_header_str;
-    if (krpcheader.SerializeToString(&rpc_header_str)) 
+
+
+// I/O 线程中没有可用连接的异步调用：带上请求的副本，交给建立连接的线程重新发出这次尝试
+static void AttemptLater(const std::shared_ptr<KrpcChannelState>& state, const KrpcCallArgs& args)
+{
+    struct Deferred
     {
-        header_size = rpc_header_str.size();
+        std::unique_ptr<google::protobuf::Message> request;
+        KrpcCallArgs args;
+    };
+    std::shared_ptr<Deferred> deferred = std::make_shared<Deferred>();
+    deferred->request.reset(args.request->New());
+    deferred->request->CopyFrom(*args.request);
+    deferred->args = args;
+    deferred->args.request = deferred->request.get();
+
+    if (!KrpcConnectionPool::DialExecutor().Submit([state, deferred]() {
+            KrpcRequestContext::Scope scope(deferred->args.requestContext);
+            Attempt(state, deferred->args);
+        }))
+    {
+        FailCall(args.controller, args.done, krpc::RPC_UNAVAILABLE, "connect server error");
     }
-    else {
-        controller->SetFailed("serialize rpc header error!");
-        return;
+}
+
+
+
+// 取得一条到 target 的连接，返回空时调用已经结束（失败），或者已经交给建立连接的线程重新尝试
+// 客户端 I/O 线程中（异步调用的 done、由 done 恢复的协程里继续发起调用）不能建立连接：新连接要同步握手，
+// 分到当前事件循环时握手的响应要等当前任务结束才能读到，只能超时失败，这段时间循环上的其他连接也都停住了。
+// 所以 I/O 线程中的异步调用只取已经建立的连接，没有时交给 AttemptLater
+static std::shared_ptr<KrpcConnection> AcquireConnection(const std::shared_ptr<KrpcChannelState>& state, const KrpcCallArgs& args,
+                                                         const KrpcServiceInstance& target)
+{
+    std::shared_ptr<KrpcConnection> conn;
+    if (args.done != nullptr && KrpcClientLoop::InClientLoopThread())
+    {
+        conn = KrpcConnectionPool::GetInstance().TryAcquire(target.ip, target.port);
+        if (!conn)  AttemptLater(state, args);
+        return conn;
+    }
+
+    // 等待连接、connect 和握手都算在调用的时限内
+    int64_t timeout_ms = 0;
+    if (!RemainingMs(args.hasDeadline, args.deadline, &timeout_ms))
+    {
+        FailCall(args.controller, args.done, krpc::RPC_DEADLINE_EXCEEDED, kKrpcCallTimeoutText);
+        return nullptr;
     }
 
-    // 拼接完整的RPC请求报文：send_rpc_str = [header_size][rpc_header_str][args_str]
-    std::string send_rpc_str;
+    krpc::rpcErrorCode code = krpc::RPC_UNAVAILABLE;
+    conn = KrpcConnectionPool::GetInstance().Acquire(target.ip, target.port, timeout_ms, &code);
+    if (!conn)
     {
-        google::protobuf::io::StringOutputStream string_output(&send_rpc_str);
-        google::protobuf::io::CodedOutputStream coded_output(&string_output);
-        coded_output.WriteVarint32(static_cast<uint32_t>(header_size)); // 写入头部长度
-        coded_output.WriteString(rpc_header_str); // 写入头部信息
+        if (code == krpc::RPC_DEADLINE_EXCEEDED)
+        {
+            FailCall(args.controller, args.done, code, kKrpcCallTimeoutText);
+            return nullptr;
+        }
+        LOG(ERROR) << "connect server error"; // 连接失败，记录错误日志
+        FailCall(args.controller, args.done, krpc::RPC_UNAVAILABLE, "connect server error");
     }
-    send_rpc_str += args_str; // 拼接请求参数
+    return conn;
+}
 
 
-    // 发送RPC请求 send_rpc_str 到服务器
-    if (-1 == send(m_clientfd, send_rpc_str.c_str(), send_rpc_str.size(), 0)) {
-        close(m_clientfd); // 发送失败，关闭Socket
-        char errtxt[512] = {};
-        std::cout << "send error: " << strerror_r(errno, errtxt, sizeof(errtxt)) << std::endl; // 打印错误信息
-        controller->SetFailed(errtxt); // 设置错误信息
-        return;
+
+// 失败的尝试能否重试，可以时给出退避时间：错误码可以重试、次数没有用完、调用没有取消、
+// 退避结束时还在时限内，最后才取出额度（不重试时不消耗额度）
+static bool NextRetry(KrpcRetryPolicy* policy, const KrpcCallArgs& args, int attempts, int64_t* backoff_ms)
+{
+    const KrpcController* controller = args.krpcController;
+    if (!controller->Failed() || controller->IsCanceled())  return false;
+    if (attempts >= policy->MaxAttempts() || !policy->Retryable(args.method, controller->ErrorCode()))  return false;
+
+    *backoff_ms = policy->BackoffMs(attempts);
+    if (args.hasDeadline && std::chrono::steady_clock::now() + std::chrono::milliseconds(*backoff_ms) >= args.deadline)
+    {
+        return false;
     }
+    return policy->Withdraw();
+}
 
-    // 发送成功，接收服务器的响应
-    char recv_buf[1024] = {0};
-    int recv_size = 0;
-    if (-1 == (recv_size = recv(m_clientfd, recv_buf, 1024, 0)))
+
+
+// 同步调用退避期间的等待，调用方的 StartCancel 可以提前结束等待
+struct KrpcRetryWait : public KrpcCancelable
+{
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool canceled = false;
+
+    void Cancel(uint64_t request_id, bool notify_server) override
     {
-        char errtxt[512] = {};
-        std::cout << "recv error" << strerror_r(errno, errtxt, sizeof(errtxt)) << std::endl; // 打印错误信息
-        controller->SetFailed(errtxt); // 设置错误信息
-        return;
+        std::lock_guard<std::mutex> lock(mutex);
+        canceled = true;
+        cv.notify_all();
     }
+};
 
-    // 将接收到的响应数据，反序列化为response对象
-    if (!response->ParseFromArray(recv_buf, recv_size)) {
-        close(m_clientfd); // 反序列化失败，关闭Socket
-        char errtxt[512] = {};
-        std::cout << "parse error" << strerror_r(errno, errtxt, sizeof(errtxt)) << std::endl;
-        controller->SetFailed(errtxt);
-        return;
+
+
+/*
+异步调用的重试：每次尝试的 done 换成 OnAttemptDone，失败且可以重试时在时间轮上等待退避时间，
+到期后在建立连接的线程（KrpcConnectionPool::DialExecutor）中发出下一次尝试（重新查询实例、取得连接），不再重试时执行调用方的 done
+
+    - 退避期间调用方的 StartCancel 取消定时器，调用立即以取消失败结束
+    - 每次尝试都在发起调用时的请求上下文中进行，done 里继续发起的调用照样继承
+    - 重试发出时调用方可能已经释放了请求、析构了 channel，所以每次尝试都使用请求的副本和 channel 的共享状态
+*/
+struct KrpcRetriedCall : public KrpcCancelable, public std::enable_shared_from_this<KrpcRetriedCall>
+{
+    std::shared_ptr<KrpcChannelState> state;
+    std::unique_ptr<google::protobuf::Message> request; // 调用方请求的副本
+    KrpcCallArgs args;              // done 为调用方的 done，request 指向副本
+    int attempts = 0;               // 已经发出的尝试次数
+    std::mutex mutex;               // 加入退避定时器和退避期间的取消互斥，取消不会漏掉刚加入的定时器
+    KrpcTimerWheel::Timer timer;    // 退避定时器
+
+    // 发出下一次尝试
+    void Start()
+    {
+        ++attempts;
+        KrpcCallArgs attempt = args;
+        std::shared_ptr<KrpcRetriedCall> self = shared_from_this();
+        attempt.done = new KrpcClosure([self]() { self->OnAttemptDone(); });
+        Attempt(state, attempt);
     }
 
+    void OnAttemptDone()
+    {
+        int64_t backoff_ms = 0;
+        if (NextRetry(state->retry.get(), args, attempts, &backoff_ms))
+        {
+            // 登记为取消对象之前已经取消的，不再重试
+            std::lock_guard<std::mutex> lock(mutex);
+            if (args.krpcController->SetCancelTarget(shared_from_this(), 0))
+            {
+                timer.callback = &KrpcRetriedCall::OnTimer;
+                timer.ctx = this;
+                timer.owner = shared_from_this();
+                KrpcTimerWheel::GetInstance().Add(&timer, backoff_ms);
+                return;
+            }
+        }
+        args.done->Run();
+    }
 
-    // close(m_clientfd); // 关闭Socket连接
-}
+    // 时间轮线程中：退避结束，交给建立连接的线程发出下一次尝试；队列满了就不再重试
+    static void OnTimer(void* ctx, uint64_t arg)
+    {
+        std::shared_ptr<KrpcRetriedCall> self = static_cast<KrpcRetriedCall*>(ctx)->shared_from_this();
+        self->timer.owner.reset();
+        if (!KrpcConnectionPool::DialExecutor().Submit([self]() {
+                KrpcRequestContext::Scope scope(self->args.requestContext);
+                self->args.krpcController->ClearFailed();
+                self->Start();
+            }))
+        {
+            KrpcRequestContext::Scope scope(self->args.requestContext);
+            self->args.done->Run();
+        }
+    }
 
+    // 调用方在退避期间取消：取消成功说明下一次尝试还没有发出，由这里结束调用
+    void Cancel(uint64_t request_id, bool notify_server) override
+    {
+        std::shared_ptr<KrpcRetriedCall> self = shared_from_this();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!KrpcTimerWheel::GetInstance().Cancel(&timer))  return;
+            timer.owner.reset();
+        }
+        args.krpcController->SetFailed(krpc::RPC_CANCELED, kKrpcCallCanceledText);
+        KrpcRequestContext::Scope scope(args.requestContext);
+        args.done->Run();
+    }
+};
 
 
 
-// 创建新的socket连接 client <---> server(ip:port)
-bool KrpcChannel::newConnect(const char *ip, uint16_t port)  // 输入服务端的 ip port
+// RPC 调用的核心方法，负责将客户端的请求序列化并发送到服务端，同时接收服务端的响应
+//   - done 为空：同步调用，阻塞到收到响应或失败
+//   - done 非空：异步调用，请求发出后立即返回，调用结束时在客户端 I/O 线程中执行 done->Run()
+void KrpcChannel::CallMethod(const ::google::protobuf::MethodDescriptor* method, // 调用哪个方法
+                ::google::protobuf::RpcController* controller, // 上下文控制器
+                const ::google::protobuf::Message* request,    // 请求参数
+                ::google::protobuf::Message* response,         // 请求响应
+                ::google::protobuf::Closure* done)             // 回调
 {
-    // 1.创建新的 Socket（客户端在本地创建的socketfd）
-    int clientfd = socket(AF_INET, SOCK_STREAM, 0); // IPv4 TCP
+    KrpcCallArgs args;
+    args.method = method;
+    args.controller = controller;
+    args.request = request;
+    args.response = response;
+    args.done = done;
+
+    // 一致性哈希的键、调用时限、取消等从 KrpcController 中取，其他控制器不带这些信息
+    args.krpcController = dynamic_cast<KrpcController*>(controller);
+    KrpcController* krpc_controller = args.krpcController;
+
+    // 时限从进入 CallMethod 开始计算，查询服务实例、取得连接的时间（以及重试的退避时间）也算在内
+    int64_t timeout_ms = (krpc_controller != nullptr && krpc_controller->TimeoutMs() >= 0) ? krpc_controller->TimeoutMs() : m_state->timeoutMs;
+    args.hasDeadline = (timeout_ms > 0);
+    if (args.hasDeadline)   args.deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+
+    // 在服务方法中发起的调用（当前线程安装了请求的上下文）不能比上游请求活得更久，取两者中较早的截止时间
+    // 上游请求已经超时的，调用方早就放弃等待了，直接失败，不再给下游增加负担
+    const std::shared_ptr<const KrpcRequestContext>& request_context = KrpcRequestContext::Current();
+    if (request_context && request_context->HasDeadline() && (!args.hasDeadline || request_context->Deadline() < args.deadline))
+    {
+        if (request_context->Expired())
+        {
+            FailCall(controller, done, krpc::RPC_DEADLINE_EXCEEDED, kKrpcCallTimeoutText);
+            return;
+        }
+        args.deadline = request_context->Deadline();
+        args.hasDeadline = true;
+    }
+    args.requestContext = request_context;
 
-    if (-1 == clientfd) { // 创建失败
-        char errtxt[512] = {0}; // 存储错误信息
-        std::cout << "socket error" << strerror_r(errno, errtxt, sizeof(errtxt)) << std::endl;
-        /* strerror 把error对应的错误信息写入errtxt*/
-        LOG(ERROR) << "socket error: " << errtxt; // 记录错误日志
-        return false;
+    if (m_state->retry && krpc_controller != nullptr && m_state->retry->Enabled(method))
+    {
+        CallWithRetry(m_state, args);
+        return;
     }
+    Attempt(m_state, args);
+}
+
 
-    // 2.设置服务器地址信息: ip-port填充 sockaddr_in 结构
-    struct sockaddr_in  server_addr;
-    server_addr.sin_family = AF_INET;            // IPv4 地址族
-    server_addr.sin_port = htons(port);          // 端口号（主机字节序 -> 网络字节序big-endian）
-    server_addr.sin_addr.s_addr = inet_addr(ip); // ip地址（点分十进制字符串 -> 网络序的32位整型）
 
-    // 3.客户端调用connect，连接服务器监听的socket（阻塞式connect，会触发TCP三次握手）
-    if (-1 == connect(clientfd, (struct sockaddr*)&server_addr, sizeof(server_addr))) 
+// 带重试的调用：每个调用存入重试额度，失败后按 NextRetry 的判断退避、重试
+static void CallWithRetry(const std::shared_ptr<KrpcChannelState>& state, const KrpcCallArgs& args)
+{
+    KrpcRetryPolicy* policy = state->retry.get();
+    policy->Deposit();
+
+    if (args.done != nullptr)
     {
-        // connect失败：关闭刚创建的socket，并打印记录错误信息
-        close(clientfd);
-        char errtxt[512] = {0};
-        std::cout << "connect error" << strerror_r(errno, errtxt, sizeof(errtxt)) << std::endl;  
-        LOG(ERROR) << "connect server error" << errtxt;  
-        return false;
+        std::shared_ptr<KrpcRetriedCall> call = std::make_shared<KrpcRetriedCall>();
+        call->state = state;
+        call->request.reset(args.request->New());
+        call->request->CopyFrom(*args.request);
+        call->args = args;
+        call->args.request = call->request.get();
+        call->Start();
+        return;
     }
 
-    // connect 成功：保存socketfd，后续用 m_clientfd 进行 send/recv
-    m_clientfd = clientfd; 
-    return true;
+    KrpcController* controller = args.krpcController;
+    for (int attempts = 1; ; ++attempts)
+    {
+        Attempt(state, args);
+
+        int64_t backoff_ms = 0;
+        if (!NextRetry(policy, args, attempts, &backoff_ms))    return;
+
+        // 退避：登记为取消对象，StartCancel 提前结束等待，下一次尝试开始时发现已经取消，直接失败
+        std::shared_ptr<KrpcRetryWait> wait = std::make_shared<KrpcRetryWait>();
+        if (controller->SetCancelTarget(wait, 0))
+        {
+            std::unique_lock<std::mutex> lock(wait->mutex);
+            wait->cv.wait_for(lock, std::chrono::milliseconds(backoff_ms), [&wait]{ return wait->canceled; });
+        }
+        controller->ClearFailed();
+    }
 }
 
 
 
-// 从ZooKeeper查询指定服务方法的服务端地址 ip:port
-std::string KrpcChannel::QueryServiceHost(ZkClient* zkclient, std::string service_name, std::string method_name, int& idx)
+// 一次尝试：done 为空时同步等待结果，非空时发出请求后立即返回
+static void Attempt(const std::shared_ptr<KrpcChannelState>& state, const KrpcCallArgs& args)
 {
-    /* 根据 service_name 和 method_name 在zookeeper中查找登记的服务节点，返回服务端的 ip:port，并把":" 位置写入idx */
+    const google::protobuf::MethodDescriptor* method = args.method;
+    google::protobuf::RpcController* controller = args.controller;
+    KrpcController* krpc_controller = args.krpcController;
+    const google::protobuf::Message* request = args.request;
+    google::protobuf::Message* response = args.response;
+    google::protobuf::Closure* done = args.done;
+
+    // 服务对象名和方法名每次调用都从方法描述符中取，同一个 channel 可以调用服务的不同方法
+    const std::string& service_name = method->service()->name();
+    const std::string& method_name = method->name();
+
+    if (krpc_controller != nullptr && krpc_controller->IsCanceled())
+    {
+        FailCall(controller, done, krpc::RPC_CANCELED, kKrpcCallCanceledText); // 调用开始前就已经取消
+        return;
+    }
+
+    // 首次调用时还不知道服务实例，先查询服务发现缓存；缓存版本号变化（实例上下线、会话过期）后重新查询
+    // 同一个 channel 可能被多个线程 / 协程并发使用，实例列表的查询和读取都在 addrMutex 保护下进行
+    KrpcServiceInstanceListPtr instances;
+    {
+        KrpcServiceDiscovery& discovery = KrpcServiceDiscovery::GetInstance();
+        std::lock_guard<std::mutex> addr_lock(state->addrMutex);
+        uint64_t version = discovery.Version();
+        if (!state->instances || version != state->discoveryVersion)
+        {
+            // 先取版本号再查询，查询期间的变化会在下一次调用时重新查询
+            std::string method_path = "/" + service_name + "/" + method_name;
+            if (!discovery.Lookup(method_path, &state->instances))  state->instances.reset();
+            state->discoveryVersion = version;
+        }
+        instances = state->instances;
+    }
+
+    // 查询失败在锁外处理：done 中可能再次通过这个 channel 发起调用
+    if (!instances)
+    {
+        FailCall(controller, done, krpc::RPC_UNAVAILABLE, "query service host fail");
+        return;
+    }
+
+    size_t args_size = request->ByteSizeLong(); // 计算并缓存序列化长度，组帧时按缓存的长度直接序列化
+    if (args_size > static_cast<size_t>(INT_MAX))
+    {
+        FailCall(controller, done, krpc::RPC_BAD_REQUEST, "serialize request fail"); // 请求过大，无法序列化
+        return;
+    }
+
+    // 开启了对冲且有多个实例时，交给对冲调用处理
+    if (state->hedge && instances->size() > 1)
+    {
+        std::shared_ptr<KrpcHedgedCall> call = std::make_shared<KrpcHedgedCall>();
+        call->method = method;
+        call->request.reset(request->New());
+        call->request->CopyFrom(*request);
+        call->argsSize = call->request->ByteSizeLong(); // 副本的序列化长度也要缓存
+        call->response = response;
+        call->controller = controller;
+        if (krpc_controller != nullptr && krpc_controller->HasRequestHash())   call->route.SetRequestHash(krpc_controller->RequestHash());
+        call->done = done;
+        call->requestContext = args.requestContext;
+        call->instances = instances;
+        call->state = state;
+        call->hasDeadline = args.hasDeadline;
+        call->deadline = args.deadline;
+        call->start = std::chrono::steady_clock::now();
+        CallHedged(call, args);
+        return;
+    }
+
+    // 由负载均衡器在所有实例中选出本次调用的服务端
+    const KrpcServiceInstance& target = (*instances)[state->balancer->Select(instances, krpc_controller)];
 
-    // 构造 method_path (每个服务方法在zk中对应一个节点，节点路径按照 "/ServiceName/MethodName" 格式组织)
-    std::string method_path = "/" + service_name + "/" + method_name; 
-    std::cout << "method_path: " << method_path << std::endl;
+    // 从连接池取得一条到服务端的连接（连接是多路复用的，可能同时被其他调用使用）
+    std::shared_ptr<KrpcConnection> conn = AcquireConnection(state, args, target);
+    if (!conn)  return;
 
-    // 从相应zknode获取数据，即服务端的 ip:port，存入 host_data_1
-    std::unique_lock<std::mutex> lock(g_data_mutx);
-    std::string host_data_1 = zkclient->GetData(method_path.c_str()); // 取出method_path路径上的节点数据（即服务端的ip:port）
-    lock.unlock();
+    int64_t timeout_ms = 0;
+    if (!RemainingMs(args.hasDeadline, args.deadline, &timeout_ms))
+    {
+        FailCall(controller, done, krpc::RPC_DEADLINE_EXCEEDED, kKrpcCallTimeoutText);
+        return;
+    }
 
-    if (host_data_1 == "") // 返回空字符串，未找到服务器地址
+    KrpcCallContext::Scope context;
+    uint64_t request_id = conn->NextRequestId(); // 连接内唯一，服务端在响应头中带回，用于匹配响应
+    if (!SerializeRequest(conn.get(), method, request, args_size, request_id, timeout_ms, args.requestContext.get(), context))
     {
-        LOG(ERROR) << method_path + " is not exist!"; // 记录错误日志
-        return " ";
+        FailCall(controller, done, krpc::RPC_BAD_REQUEST, "serialize request fail");
+        return;
     }
 
-    idx = host_data_1.find(":"); // 查找第一次出现":"的位置，返回索引赋给idx
-    if (idx == -1) // 分隔符不存在，不合法地址
+
+    // 异步调用：交给连接所在的 I/O 线程，收到响应后由 I/O 线程反序列化 response 并执行 done->Run()
+    if (done != nullptr)
     {
-        LOG(ERROR) << method_path + " address is invalid!"; 
-        return " ";
+        conn->CallAsync(request_id, &context->Frame(), response, controller, done, timeout_ms);
+        return;
     }
 
-    // 返回服务器地址 ip:port
-    return host_data_1; 
+    // 同步调用：发送RPC请求到服务器，并等待 I/O 线程按 request_id 把响应反序列化到 response 中
+    std::string errText;
+    krpc::rpcErrorCode errCode = krpc::RPC_OK;
+    if (!conn->Call(request_id, &context->Frame(), response, &errText, &errCode, timeout_ms, krpc_controller))
+    {
+        LOG(ERROR) << "rpc call error: " << errText;
+        KrpcSetFailed(controller, errCode, errText); // 设置错误信息
+        return;
+    }
 }
 
+
+
+// 对冲调用：先发出主分支，再在时间轮上加入对冲定时器；同步调用等待结果交付
+static void CallHedged(const std::shared_ptr<KrpcHedgedCall>& call, const KrpcCallArgs& args)
+{
+    KrpcController* krpc_controller = args.krpcController;
+    KrpcHedgePolicy* hedge = call->state->hedge.get();
+    call->primaryIndex = call->state->balancer->Select(call->instances, krpc_controller);
+    const KrpcServiceInstance& target = (*call->instances)[call->primaryIndex];
+    std::shared_ptr<KrpcConnection> conn = AcquireConnection(call->state, args, target);
+    if (!conn)  return;
+
+    // 调用方的 StartCancel 取消所有分支
+    if (krpc_controller != nullptr && !krpc_controller->SetCancelTarget(call, 0))
+    {
+        FailCall(call->controller, call->done, krpc::RPC_CANCELED, kKrpcCallCanceledText);
+        return;
+    }
+
+    hedge->Deposit();
+    call->Launch(0, conn);
+
+    // 时限内来不及发备份请求、或者按分位数对冲但样本还不够时不加定时器；主分支已经结束时也不再加入
+    int64_t delay_ms = hedge->DelayMs();
+    if (delay_ms > 0 && (!call->hasDeadline || call->start + std::chrono::milliseconds(delay_ms) < call->deadline))
+    {
+        std::lock_guard<std::mutex> lock(call->mutex);
+        if (!call->delivered)
+        {
+            call->timer.callback = &KrpcHedgedCall::OnTimer;
+            call->timer.ctx = call.get();
+            call->timer.owner = call;
+            KrpcTimerWheel::GetInstance().Add(&call->timer, delay_ms);
+        }
+    }
+
+    if (call->done != nullptr)  return;
+
+    {
+        std::unique_lock<std::mutex> lock(call->mutex);
+        call->cv.wait(lock, [&call]{ return call->finished; });
+    }
+    if (call->failed)
+    {
+        LOG(ERROR) << "rpc call error: " << call->errText;
+        KrpcSetFailed(call->controller, call->errCode, call->errText);
+    }
+}
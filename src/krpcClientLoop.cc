@@ -0,0 +1,212 @@
+#include "krpcClientLoop.h"
+#include "krpcConnection.h"
+#include "krpcApplication.h"
+#include "krpcLogger.h"
+#include "krpcWorkStealingExecutor.h"
+
+#include <errno.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+
+
+// 当前线程是否是客户端事件循环的线程，由循环线程自己设置
+static thread_local bool t_inClientLoop = false;
+
+bool KrpcClientLoop::InClientLoopThread()
+{
+    return t_inClientLoop;
+}
+
+
+KrpcClientLoop::KrpcClientLoop() : m_quit(false)
+{
+    m_epollfd = epoll_create1(EPOLL_CLOEXEC);
+    m_wakeupfd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (m_epollfd < 0 || m_wakeupfd < 0)
+    {
+        LOG(FATAL) << "create client event loop failed";
+    }
+
+    // 监听 eventfd，其他线程投递任务后写 eventfd 唤醒循环线程
+    struct epoll_event ev;
+    ev.events = EPOLLIN;
+    ev.data.fd = m_wakeupfd;
+    epoll_ctl(m_epollfd, EPOLL_CTL_ADD, m_wakeupfd, &ev);
+
+    m_thread = std::thread(&KrpcClientLoop::Loop, this);
+}
+
+
+KrpcClientLoop::~KrpcClientLoop()
+{
+    m_quit.store(true);
+    Wakeup();
+    if (m_thread.joinable())    m_thread.join();
+
+    m_conns.clear();
+    close(m_wakeupfd);
+    close(m_epollfd);
+}
+
+
+
+void KrpcClientLoop::RunInLoop(Task task)
+{
+    if (IsInLoopThread())
+    {
+        task();
+    }
+    else
+    {
+        QueueInLoop(std::move(task));
+    }
+}
+
+
+void KrpcClientLoop::QueueInLoop(Task task)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_tasks.push_back(std::move(task));
+    }
+    Wakeup();
+}
+
+
+void KrpcClientLoop::Wakeup()
+{
+    uint64_t one = 1;
+    ssize_t n = write(m_wakeupfd, &one, sizeof(one));
+    (void)n;
+}
+
+
+
+// 注册连接：循环持有连接的一份引用，直到 RemoveConnection
+void KrpcClientLoop::AddConnection(const std::shared_ptr<KrpcConnection>& conn, int fd)
+{
+    struct epoll_event ev;
+    ev.events = EPOLLIN;
+    ev.data.fd = fd;
+    if (epoll_ctl(m_epollfd, EPOLL_CTL_ADD, fd, &ev) < 0)
+    {
+        LOG(ERROR) << "epoll_ctl add fd " << fd << " failed";
+        return;
+    }
+    m_conns[fd] = conn;
+}
+
+
+void KrpcClientLoop::UpdateConnection(int fd, uint32_t events)
+{
+    struct epoll_event ev;
+    ev.events = events;
+    ev.data.fd = fd;
+    epoll_ctl(m_epollfd, EPOLL_CTL_MOD, fd, &ev);
+}
+
+
+void KrpcClientLoop::RemoveConnection(int fd)
+{
+    epoll_ctl(m_epollfd, EPOLL_CTL_DEL, fd, nullptr);
+    m_conns.erase(fd);
+}
+
+
+
+// 循环线程：等待 I/O 事件 -> 交给对应的连接处理 -> 执行其他线程投递的任务
+void KrpcClientLoop::Loop()
+{
+    m_threadId.store(std::this_thread::get_id(), std::memory_order_release);
+    t_inClientLoop = true;
+
+    std::vector<struct epoll_event> events(64);
+    while (!m_quit.load())
+    {
+        int n = epoll_wait(m_epollfd, events.data(), static_cast<int>(events.size()), 10000);
+        if (n < 0)
+        {
+            if (errno != EINTR) LOG(ERROR) << "epoll_wait error: " << errno;
+            continue;
+        }
+
+        for (int i = 0; i < n; ++i)
+        {
+            int fd = events[i].data.fd;
+            if (fd == m_wakeupfd)
+            {
+                uint64_t one;
+                ssize_t r = read(m_wakeupfd, &one, sizeof(one));
+                (void)r;
+                continue;
+            }
+
+            auto it = m_conns.find(fd);
+            if (it == m_conns.end())    continue;
+
+            // 拷贝一份引用，处理过程中连接即使被注销也不会析构
+            std::shared_ptr<KrpcConnection> conn = it->second;
+            conn->HandleEvent(events[i].events);
+        }
+
+        if (static_cast<size_t>(n) == events.size())    events.resize(events.size() * 2); // 事件数组满了，扩容
+
+        DoPendingTasks();
+    }
+}
+
+
+// 执行任务队列：先交换出来再执行，执行期间其他线程仍然可以投递任务
+void KrpcClientLoop::DoPendingTasks()
+{
+    std::vector<Task> tasks;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        tasks.swap(m_tasks);
+    }
+    for (Task& task : tasks)    task();
+}
+
+
+
+
+KrpcClientLoopPool& KrpcClientLoopPool::GetInstance()
+{
+    static KrpcClientLoopPool pool;
+    return pool;
+}
+
+
+KrpcClientLoopPool::KrpcClientLoopPool() : m_next(0)
+{
+    int threads = KrpcApplication::GetConfig().LoadInt("client_io_threads", 2);
+    if (threads < 1)    threads = 1;
+
+    for (int i = 0; i < threads; ++i)
+    {
+        m_loops.emplace_back(new KrpcClientLoop());
+    }
+
+    // 回调里有较重的处理时，把回调挪到工作线程执行，避免拖慢 I/O 线程上其他调用的响应
+    int callback_threads = KrpcApplication::GetConfig().LoadInt("client_callback_threads", 0);
+    if (callback_threads > 0)
+    {
+        m_callbackExecutor.reset(new KrpcWorkStealingExecutor(callback_threads, 65536));
+    }
+}
+
+
+// 先停止事件循环，不再产生新的回调，再等待回调执行器执行完剩余的回调
+KrpcClientLoopPool::~KrpcClientLoopPool()
+{
+    m_loops.clear();
+    m_callbackExecutor.reset();
+}
+
+
+KrpcClientLoop* KrpcClientLoopPool::GetNextLoop()
+{
+    uint32_t idx = m_next.fetch_add(1, std::memory_order_relaxed);
+    return m_loops[idx % m_loops.size()].get();
+}
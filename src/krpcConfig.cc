@@ -56,6 +56,21 @@ std::string KrpcConfig::Load(const std::string &key)
 
 
 
+// 根据key查找整数value，未配置或不是合法整数时返回 default_value
+int KrpcConfig::LoadInt(const std::string &key, int default_value)
+{
+    std::string value = Load(key);
+    if (value.empty())  return default_value;
+
+    char* end = nullptr;
+    long result = strtol(value.c_str(), &end, 10);
+    if (end == value.c_str() || *end != '\0')   return default_value; // 含有非数字字符
+
+    return static_cast<int>(result);
+}
+
+
+
 // 去掉字符串前后的空格
 void KrpcConfig::Trim(std::string& read_buf)
 {
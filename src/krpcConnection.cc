@@ -0,0 +1,760 @@
+#include <errno.h>      // 提供错误码errno定义
+#include <fcntl.h>      // fcntl 设置非阻塞
+#include <poll.h>       // poll 等待非阻塞 connect 完成
+#include <string.h>     // strerror_r
+#include <unistd.h>     // 提供close()等系统调用
+#include <sys/epoll.h>  // epoll 事件定义
+#include <sys/socket.h> // socket接口
+#include <arpa/inet.h>  // ip 地址与网络字节序的转换函数
+#include <netinet/in.h>
+#include <netinet/tcp.h> // TCP_NODELAY
+
+#include "krpcConnection.h"
+#include "krpcClientLoop.h"
+#include "krpcExecutor.h"
+#include "krpcFrame.h"
+#include "krpcHeader.pb.h"
+#include "krpcLogger.h"
+
+#include <google/protobuf/io/coded_stream.h>
+#include <climits>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+
+
+const size_t KrpcPendingTable::kInitialBuckets;
+
+
+KrpcPendingTable::KrpcPendingTable() : m_buckets(kInitialBuckets, nullptr), m_count(0)
+{
+}
+
+
+void KrpcPendingTable::Insert(uint64_t request_id, KrpcPendingCall* call)
+{
+    if (m_count >= m_buckets.size())    Rehash(m_buckets.size() * 2);
+
+    KrpcPendingCall*& head = m_buckets[request_id & (m_buckets.size() - 1)];
+    call->requestId = request_id;
+    call->next = head;
+    head = call;
+    ++m_count;
+}
+
+
+KrpcPendingCall* KrpcPendingTable::Remove(uint64_t request_id)
+{
+    KrpcPendingCall** link = &m_buckets[request_id & (m_buckets.size() - 1)];
+    while (*link != nullptr)
+    {
+        KrpcPendingCall* call = *link;
+        if (call->requestId == request_id)
+        {
+            *link = call->next;
+            call->next = nullptr;
+            --m_count;
+            return call;
+        }
+        link = &call->next;
+    }
+    return nullptr;
+}
+
+
+KrpcPendingCall* KrpcPendingTable::TakeAll()
+{
+    KrpcPendingCall* all = nullptr;
+    for (KrpcPendingCall*& head : m_buckets)
+    {
+        while (head != nullptr)
+        {
+            KrpcPendingCall* call = head;
+            head = call->next;
+            call->next = all;
+            all = call;
+        }
+    }
+    m_count = 0;
+    return all;
+}
+
+
+void KrpcPendingTable::Rehash(size_t buckets)
+{
+    KrpcPendingCall* all = TakeAll();
+    size_t count = 0;
+    m_buckets.assign(buckets, nullptr);
+    while (all != nullptr)
+    {
+        KrpcPendingCall* call = all;
+        all = call->next;
+        KrpcPendingCall*& head = m_buckets[call->requestId & (buckets - 1)];
+        call->next = head;
+        head = call;
+        ++count;
+    }
+    m_count = count;
+}
+
+
+
+
+KrpcConnection::KrpcConnection(const std::string& ip, uint16_t port)
+    : m_fd(-1), m_ip(ip), m_port(port), m_loop(nullptr),
+      m_nextRequestId(1), m_broken(false), m_inflight(0), m_stats(KrpcEndpointStats::Get(ip, port)),
+      m_events(0), m_registered(false), m_frameVersion(0)
+{
+    Touch();
+}
+
+// 析构：连接注销后事件循环不再持有引用，此时才会析构，可以安全地关闭 fd
+KrpcConnection::~KrpcConnection()
+{
+    if (-1 != m_fd) close(m_fd);
+}
+
+
+
+// 创建新的socket连接 client <---> server(ip:port)
+bool KrpcConnection::Connect(int64_t connect_timeout_ms, int64_t budget_ms)
+{
+    // 调用剩余的时限同时约束 connect 和握手：对端不可达时内核的 SYN 重传要等一两分钟，不能让调用跟着等
+    auto start = std::chrono::steady_clock::now();
+    auto remaining_ms = [start, budget_ms](int64_t limit_ms) -> int64_t {
+        if (budget_ms <= 0)     return limit_ms;
+        int64_t left = budget_ms - std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+        return left < limit_ms ? left : limit_ms;
+    };
+
+    // 1.创建新的 Socket（客户端在本地创建的socketfd）
+    int clientfd = socket(AF_INET, SOCK_STREAM, 0); // IPv4 TCP
+    if (-1 == clientfd)
+    {
+        char errtxt[512] = {0};
+        LOG(ERROR) << "socket error: " << strerror_r(errno, errtxt, sizeof(errtxt));
+        return false;
+    }
+
+    // 2.设置服务器地址信息: ip-port填充 sockaddr_in 结构
+    struct sockaddr_in server_addr;
+    server_addr.sin_family = AF_INET;                   // IPv4 地址族
+    server_addr.sin_port = htons(m_port);               // 端口号（主机字节序 -> 网络字节序）
+    server_addr.sin_addr.s_addr = inet_addr(m_ip.c_str()); // ip地址（点分十进制字符串 -> 网络序的32位整型）
+
+    // 3.非阻塞connect，触发TCP三次握手，用 poll 等待握手完成，最多等待 connect_timeout_ms（和剩余的时限）
+    //   之后的收发也都是非阻塞的，不会阻塞线程
+    fcntl(clientfd, F_SETFL, fcntl(clientfd, F_GETFL, 0) | O_NONBLOCK);
+    int err = 0;
+    if (-1 == connect(clientfd, (struct sockaddr*)&server_addr, sizeof(server_addr)))
+    {
+        err = errno;
+        while (err == EINPROGRESS || err == EINTR)
+        {
+            int64_t wait_ms = remaining_ms(connect_timeout_ms);
+            if (wait_ms <= 0)
+            {
+                err = ETIMEDOUT;
+                break;
+            }
+            struct pollfd pfd = { clientfd, POLLOUT, 0 };
+            int n = poll(&pfd, 1, static_cast<int>(wait_ms > INT_MAX ? INT_MAX : wait_ms));
+            if (n == 0)         err = ETIMEDOUT;
+            else if (n < 0)     err = errno; // EINTR 时重新计算等待时间继续等
+            else
+            {
+                socklen_t len = sizeof(err);
+                if (-1 == getsockopt(clientfd, SOL_SOCKET, SO_ERROR, &err, &len))  err = errno;
+            }
+        }
+    }
+    if (err != 0)
+    {
+        char errtxt[512] = {0};
+        LOG(ERROR) << "connect " << m_ip << ":" << m_port << " error: " << strerror_r(err, errtxt, sizeof(errtxt));
+        close(clientfd);
+        return false;
+    }
+
+    // rpc 请求都是小包，关闭 Nagle 算法避免延迟
+    int on = 1;
+    setsockopt(clientfd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+
+    m_fd = clientfd;
+    Touch();
+
+    // 4.注册到一个 I/O 事件循环上，由 I/O 线程接收并分发这条连接上的所有响应
+    m_loop = KrpcClientLoopPool::GetInstance().GetNextLoop();
+    std::shared_ptr<KrpcConnection> self = shared_from_this();
+    m_loop->RunInLoop([self]() {
+        self->m_events = EPOLLIN;
+        self->m_loop->AddConnection(self, self->m_fd);
+        self->m_registered = true;
+    });
+
+    // 5.握手：取得服务端的方法表，之后的请求只带方法编号
+    int64_t handshake_ms = remaining_ms(kHandshakeTimeoutMs);
+    if (handshake_ms <= 0)
+    {
+        MarkBroken("no time left for handshake");
+        return false;
+    }
+    return Handshake(handshake_ms);
+}
+
+
+
+bool KrpcConnection::Handshake(int64_t timeout_ms)
+{
+    krpc::rpcHandshakeRequest request;
+    request.set_max_frame_version(kKrpcFrameVersion);
+
+    krpc::rpcHeader header;
+    uint64_t request_id = NextRequestId();
+    header.set_service_name(kKrpcHandshakeService);
+    header.set_args_size(static_cast<uint32_t>(request.ByteSizeLong()));
+    header.set_request_id(request_id);
+
+    KrpcIOBuf frame;
+    krpc::rpcHandshakeResponse response;
+    std::string errText;
+    krpc::rpcErrorCode errCode = krpc::RPC_OK;
+    if (!KrpcSerializeFrame(header, &request, &frame) || !Call(request_id, &frame, &response, &errText, &errCode, timeout_ms))
+    {
+        if (IsBroken() || errCode == krpc::RPC_DEADLINE_EXCEEDED)
+        {
+            // 握手超时后服务端随时可能回复并切换帧头，这条连接不能再用
+            LOG(ERROR) << "handshake with " << m_ip << ":" << m_port << " error: " << errText;
+            if (!IsBroken())    MarkBroken("handshake timeout");
+            return false;
+        }
+        // 服务端不支持握手（旧版本），继续按服务名 + 方法名调用
+        LOG(WARNING) << "handshake with " << m_ip << ":" << m_port << " unsupported: " << errText;
+        return true;
+    }
+
+    // 只记录本地也有生成代码的方法，客户端用不到的方法不需要编号
+    const google::protobuf::DescriptorPool* pool = google::protobuf::DescriptorPool::generated_pool();
+    for (int i = 0; i < response.methods_size(); ++i)
+    {
+        const google::protobuf::MethodDescriptor* method = pool->FindMethodByName(response.methods(i));
+        if (method != nullptr)  m_methodIds[method] = static_cast<uint32_t>(i + 1);
+    }
+
+    // 服务端发出回复后就切换了帧头，之后的请求和响应都使用协商好的格式
+    if (response.frame_version() == kKrpcFrameVersion)
+    {
+        m_frameVersion.store(kKrpcFrameVersion, std::memory_order_release);
+    }
+    return true;
+}
+
+
+
+uint32_t KrpcConnection::MethodId(const google::protobuf::MethodDescriptor* method) const
+{
+    auto it = m_methodIds.find(method);
+    return (it != m_methodIds.end()) ? it->second : 0;
+}
+
+
+
+// 关闭连接：在 I/O 线程中注销并结束所有在途调用
+void KrpcConnection::Close()
+{
+    if (m_loop == nullptr)
+    {
+        MarkBroken("connection closed by client");
+        return;
+    }
+    std::shared_ptr<KrpcConnection> self = shared_from_this();
+    m_loop->RunInLoop([self]() { self->HandleClose("connection closed by client"); });
+}
+
+
+
+// 登记一个在途调用：先登记再发送，保证 I/O 线程收到响应时一定能找到对应的调用
+// 定时器在锁内加入：登记之后调用随时可能被其他线程结束（连接出错），结束前必须能取消定时器
+krpc::rpcErrorCode KrpcConnection::AddPending(uint64_t request_id, KrpcPendingCall* call, int64_t timeout_ms, const KrpcController* controller)
+{
+    std::lock_guard<std::mutex> lock(m_pendingMutex);
+    if (IsBroken()) return krpc::RPC_UNAVAILABLE;
+
+    // StartCancel 先设置取消标志再取消登记的调用（要从在途调用中取出，需要 m_pendingMutex）：
+    // 这里没有看到标志，它的取消一定在登记之后才执行，能找到这个调用
+    if (controller != nullptr && controller->IsCanceled())  return krpc::RPC_CANCELED;
+
+    call->startTime = std::chrono::steady_clock::now().time_since_epoch().count();
+    m_pending.Insert(request_id, call);
+    m_inflight.fetch_add(1, std::memory_order_relaxed);
+    m_stats->inflight.fetch_add(1, std::memory_order_relaxed);
+
+    if (timeout_ms > 0)
+    {
+        call->timer.callback = &KrpcConnection::OnCallTimeout;
+        call->timer.ctx = this;
+        call->timer.arg = request_id;
+        call->timer.owner = shared_from_this(); // 超时回调执行时连接还活着
+        KrpcTimerWheel::GetInstance().Add(&call->timer, timeout_ms);
+    }
+    return krpc::RPC_OK;
+}
+
+
+
+KrpcPendingCall* KrpcConnection::TakePending(uint64_t request_id)
+{
+    KrpcPendingCall* call = m_pending.Remove(request_id);
+    if (call != nullptr)
+    {
+        m_inflight.fetch_sub(1, std::memory_order_relaxed);
+        m_stats->inflight.fetch_sub(1, std::memory_order_relaxed);
+    }
+    return call;
+}
+
+
+
+// 调用超时：和收到响应、连接出错一样先从在途调用中取出，谁先取到谁结束调用，另外两方就找不到这个调用了
+void KrpcConnection::OnCallTimeout(void* ctx, uint64_t request_id)
+{
+    KrpcConnection* self = static_cast<KrpcConnection*>(ctx);
+    KrpcPendingCall* call = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(self->m_pendingMutex);
+        call = self->TakePending(request_id);
+    }
+    if (call == nullptr)    return;
+
+    // 超时也算一个延迟样本，负载均衡会避开响应慢的服务端
+    std::chrono::steady_clock::duration latency(std::chrono::steady_clock::now().time_since_epoch().count() - call->startTime);
+    self->m_stats->Record(std::chrono::duration_cast<std::chrono::microseconds>(latency).count());
+    Finish(call, krpc::RPC_DEADLINE_EXCEEDED, kKrpcCallTimeoutText);
+}
+
+
+
+void KrpcConnection::BindCanceler(uint64_t request_id, KrpcController* controller)
+{
+    if (controller != nullptr)  controller->SetCancelTarget(shared_from_this(), request_id); // 已经取消时不登记，AddPending 会发现
+}
+
+
+
+// 取消调用：和超时一样先从在途调用中取出，取到了才结束调用、通知服务端
+// 取消帧只带请求id：protobuf 帧头为保留服务名 kKrpcCancelService，固定帧头为 kKrpcFlagCancel 标志，服务端不回复
+void KrpcConnection::Cancel(uint64_t request_id, bool notify_server)
+{
+    KrpcPendingCall* call = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_pendingMutex);
+        call = TakePending(request_id);
+    }
+    if (call == nullptr)    return;
+    KrpcTimerWheel::GetInstance().Cancel(&call->timer);
+
+    if (notify_server)
+    {
+        KrpcIOBuf frame;
+        bool serialized = false;
+        if (FrameVersion() != 0)
+        {
+            KrpcFixedHeader fixed;
+            fixed.flags = kKrpcFlagCancel;
+            fixed.request_id = request_id;
+            serialized = KrpcSerializeFixedFrame(fixed, nullptr, nullptr, &frame);
+        }
+        else
+        {
+            krpc::rpcHeader header;
+            header.set_service_name(kKrpcCancelService);
+            header.set_request_id(request_id);
+            serialized = KrpcSerializeFrame(header, nullptr, &frame);
+        }
+        if (serialized && !Send(&frame))
+        {
+            char errtxt[512] = {0};
+            MarkBroken(std::string("send error: ") + strerror_r(errno, errtxt, sizeof(errtxt)));
+        }
+    }
+
+    Finish(call, krpc::RPC_CANCELED, kKrpcCallCanceledText);
+}
+
+
+
+// 发送一帧数据：发送缓冲区为空时先在当前线程直接写，写不完的部分转移到发送缓冲区，由 I/O 线程继续发送
+bool KrpcConnection::Send(KrpcIOBuf* frame)
+{
+    std::lock_guard<std::mutex> lock(m_sendMutex); // 整帧写出，不与其他线程的请求交错
+    if (IsBroken()) return false;
+
+    if (!m_sendBuf.Empty())
+    {
+        m_sendBuf.Append(std::move(*frame)); // 缓冲区里还有数据时不能直接写，否则会打乱顺序
+        Touch();
+        return true;
+    }
+
+    // 写出的部分从 frame 中移除，内存块归还到当前线程的缓存
+    int saved_errno = 0;
+    ssize_t n = frame->WriteToSocket(m_fd, &saved_errno);
+    if (n < 0 && saved_errno != EAGAIN && saved_errno != EWOULDBLOCK && saved_errno != EINTR)
+    {
+        errno = saved_errno;
+        return false;
+    }
+
+    // 短写：剩下的数据放进发送缓冲区，由 I/O 线程在可写时继续发送
+    if (!frame->Empty())
+    {
+        m_sendBuf.Append(std::move(*frame));
+
+        // 持有 m_sendMutex，只能投递到下一轮循环执行，不能在当前线程直接执行
+        std::shared_ptr<KrpcConnection> self = shared_from_this();
+        m_loop->QueueInLoop([self]() { self->EnableWriting(); });
+    }
+    Touch();
+    return true;
+}
+
+
+
+// 同步调用：发送一帧请求并阻塞等待对应的响应
+bool KrpcConnection::Call(uint64_t request_id, KrpcIOBuf* frame, google::protobuf::Message* response, std::string* errText,
+                          krpc::rpcErrorCode* errCode, int64_t timeout_ms, KrpcController* controller)
+{
+    KrpcPendingCall call;
+    call.response = response;
+
+    BindCanceler(request_id, controller);
+    krpc::rpcErrorCode added = AddPending(request_id, &call, timeout_ms, controller);
+    if (added != krpc::RPC_OK)
+    {
+        *errText = (added == krpc::RPC_CANCELED) ? kKrpcCallCanceledText : "connection is broken"; // 已经取消的不再发送
+        if (errCode != nullptr)     *errCode = added;
+        return false;
+    }
+
+    if (!Send(frame))
+    {
+        // 发送失败后连接上的数据已不完整，整条连接作废，所有在途调用（包括本次）都以失败结束
+        char errtxt[512] = {0};
+        MarkBroken(std::string("send error: ") + strerror_r(errno, errtxt, sizeof(errtxt)));
+    }
+
+    // 等待 I/O 线程分发响应，或者连接出错、超时
+    {
+        std::unique_lock<std::mutex> lock(call.mutex);
+        call.cv.wait(lock, [&call]{ return call.finished; });
+    }
+
+    if (call.failed)
+    {
+        *errText = call.errText;
+        if (errCode != nullptr)     *errCode = call.errorCode;
+        return false;
+    }
+    return true;
+}
+
+
+
+// 异步调用：登记并发送后立即返回，结束时由 Finish 执行 done 回调
+void KrpcConnection::CallAsync(uint64_t request_id, KrpcIOBuf* frame, google::protobuf::Message* response,
+                               google::protobuf::RpcController* controller, google::protobuf::Closure* done, int64_t timeout_ms)
+{
+    KrpcPendingCall* call = new KrpcPendingCall();
+    call->response = response;
+    call->controller = controller;
+    call->done = done;
+    call->context = KrpcRequestContext::Current();
+
+    // 登记之后 call 随时可能被其他线程结束并释放（done 可能连同控制器一起释放），不能再访问 call 和 controller
+    KrpcController* krpc_controller = dynamic_cast<KrpcController*>(controller);
+    BindCanceler(request_id, krpc_controller);
+    krpc::rpcErrorCode added = AddPending(request_id, call, timeout_ms, krpc_controller);
+    if (added != krpc::RPC_OK)
+    {
+        Finish(call, added, (added == krpc::RPC_CANCELED) ? kKrpcCallCanceledText : "connection is broken"); // 已经取消的不再发送
+        return;
+    }
+
+    if (!Send(frame))
+    {
+        char errtxt[512] = {0};
+        MarkBroken(std::string("send error: ") + strerror_r(errno, errtxt, sizeof(errtxt)));
+    }
+}
+
+
+
+// I/O 线程：处理 epoll 返回的事件
+void KrpcConnection::HandleEvent(uint32_t events)
+{
+    if ((events & (EPOLLERR | EPOLLHUP)) && !(events & EPOLLIN))
+    {
+        HandleClose("connection error");
+        return;
+    }
+    if (events & (EPOLLIN | EPOLLPRI | EPOLLRDHUP)) HandleRead();
+    if (m_registered && (events & EPOLLOUT))        HandleWrite();
+}
+
+
+// 发送缓冲区有数据，开始监听可写事件
+void KrpcConnection::EnableWriting()
+{
+    std::lock_guard<std::mutex> lock(m_sendMutex);
+    if (!m_registered || m_sendBuf.Empty() || (m_events & EPOLLOUT))   return;
+
+    m_events |= EPOLLOUT;
+    m_loop->UpdateConnection(m_fd, m_events);
+}
+
+
+// 读事件：读入接收缓冲区，拆出完整的响应帧并分发
+void KrpcConnection::HandleRead()
+{
+    int saved_errno = 0;
+    ssize_t n = m_recvBuf.ReadFromFd(m_fd, kMaxReadBytes, &saved_errno); // 直接读入接收缓冲区的内存块
+    if (n > 0)
+    {
+        Touch();
+        if (!DispatchFrames())
+        {
+            LOG(ERROR) << "invalid response frame from " << m_ip << ":" << m_port;
+            HandleClose("invalid response frame");
+        }
+        return;
+    }
+    if (n < 0 && (saved_errno == EAGAIN || saved_errno == EWOULDBLOCK || saved_errno == EINTR))    return;
+
+    // n == 0 对端关闭；n < 0 读出错
+    char errtxt[512] = {0};
+    std::string reason = (n == 0) ? "connection closed by server"
+                                  : std::string("recv error: ") + strerror_r(saved_errno, errtxt, sizeof(errtxt));
+    if (!IsBroken())    LOG(ERROR) << m_ip << ":" << m_port << " " << reason;
+    HandleClose(reason);
+}
+
+
+// 写事件：继续发送缓冲区里的数据，发完后不再监听可写事件
+void KrpcConnection::HandleWrite()
+{
+    std::unique_lock<std::mutex> lock(m_sendMutex);
+    int saved_errno = 0;
+    ssize_t n = m_sendBuf.WriteToSocket(m_fd, &saved_errno); // 写出的部分已从发送缓冲区移除
+    if (n > 0)
+    {
+        Touch();
+        if (m_sendBuf.Empty())
+        {
+            m_events &= ~EPOLLOUT;
+            m_loop->UpdateConnection(m_fd, m_events);
+        }
+        return;
+    }
+    if (n < 0 && (saved_errno == EAGAIN || saved_errno == EWOULDBLOCK || saved_errno == EINTR))  return;
+
+    char errtxt[512] = {0};
+    std::string reason = std::string("send error: ") + strerror_r(saved_errno, errtxt, sizeof(errtxt));
+    lock.unlock();
+    HandleClose(reason);
+}
+
+
+// 连接关闭：从事件循环上注销（释放循环持有的引用），所有在途调用以失败结束
+void KrpcConnection::HandleClose(const std::string& reason)
+{
+    if (m_registered)
+    {
+        m_registered = false;
+        m_loop->RemoveConnection(m_fd);
+    }
+    MarkBroken(reason);
+}
+
+
+
+// 从 m_recvBuf 中解析出所有完整的响应帧：【header长度(varint)】+【rpcResponseHeader】+【body】
+// 直接在接收缓冲区的内存块链上反序列化，不做额外拷贝；大响应分散在多个内存块中，不会因为扩容反复搬移数据
+bool KrpcConnection::DispatchFrames()
+{
+    while (!m_recvBuf.Empty())
+    {
+        size_t frame_size = 0;
+        int ret = DispatchOneFrame(&frame_size);
+        if (ret < 0)    return false;
+        if (ret == 0)   break;
+        m_recvBuf.PopFront(frame_size); // 整帧处理完后再移除，解析用的输入流此时已经销毁
+    }
+    return true;
+}
+
+
+
+// 解析并分发接收缓冲区开头的一帧：返回 1 表示已分发（frame_size 为整帧长度），0 表示数据不够，-1 表示格式错误
+int KrpcConnection::DispatchOneFrame(size_t* frame_size)
+{
+    size_t avail = m_recvBuf.Size();
+
+    // 直接在接收缓冲区的内存块链上解析，帧可能跨越多个内存块
+    KrpcIOBufInputStream frame_input(m_recvBuf);
+    google::protobuf::io::CodedInputStream coded_input(&frame_input);
+
+    // 解析响应头，得到 request_id、响应长度和错误码
+    krpc::rpcResponseHeader header;
+    int ret = (FrameVersion() != 0) ? ReadFixedResponseHeader(&coded_input, avail, &header, frame_size)
+                                    : ReadResponseHeader(&coded_input, avail, &header, frame_size);
+    if (ret <= 0)   return ret; // 响应还没收全，新数据追加到新的内存块，已收到的数据不会搬动
+
+    // 按 request_id 找到等待的调用，取出后再反序列化（调用结束前 response 对象一直有效）
+    KrpcPendingCall* call = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_pendingMutex);
+        call = TakePending(header.request_id());
+    }
+    if (call != nullptr)
+    {
+        KrpcTimerWheel::GetInstance().Cancel(&call->timer); // 取消失败说明超时回调正在执行，它已经找不到这个调用了
+        std::chrono::steady_clock::duration latency(std::chrono::steady_clock::now().time_since_epoch().count() - call->startTime);
+        m_stats->Record(std::chrono::duration_cast<std::chrono::microseconds>(latency).count());
+    }
+
+    if (call == nullptr)
+    {
+        // 调用已经超时结束，响应来得太晚，直接丢弃
+        LOG(WARNING) << "unknown request_id " << header.request_id() << " from " << m_ip << ":" << m_port;
+    }
+    else if (header.error_code() != krpc::RPC_OK)
+    {
+        Finish(call, header.error_code(), header.error_text()); // 服务端返回了框架错误
+    }
+    else
+    {
+        google::protobuf::io::CodedInputStream::Limit limit = coded_input.PushLimit(static_cast<int>(header.body_size()));
+        bool parsed = call->response->ParseFromCodedStream(&coded_input);
+        coded_input.PopLimit(limit);
+        Finish(call, parsed ? krpc::RPC_OK : krpc::RPC_INTERNAL_ERROR, parsed ? "" : "parse response error");
+    }
+    return 1;
+}
+
+
+
+// protobuf 帧头：【header长度(varint)】+【rpcResponseHeader】
+int KrpcConnection::ReadResponseHeader(google::protobuf::io::CodedInputStream* input, size_t avail,
+                                       krpc::rpcResponseHeader* header, size_t* frame_size)
+{
+    // 读取 header 长度，数据不够时等待下一次读事件
+    uint32_t header_size = 0;
+    if (!input->ReadVarint32(&header_size))
+    {
+        return (avail >= 5) ? -1 : 0; // varint32 最多5个字节，读不出来说明数据格式错误
+    }
+    size_t varint_size = input->CurrentPosition();
+    if (avail < varint_size + header_size)  return 0;
+
+    google::protobuf::io::CodedInputStream::Limit limit = input->PushLimit(static_cast<int>(header_size));
+    if (!header->ParseFromCodedStream(input))   return -1;
+    input->PopLimit(limit);
+
+    *frame_size = varint_size + header_size + header->body_size();
+    return (avail < *frame_size) ? 0 : 1;
+}
+
+
+// 固定帧头：【固定帧头】+【meta（出错时带错误信息的 rpcResponseHeader）】，帧头在接收缓冲区中可能跨越内存块，先拷贝出来再解码
+int KrpcConnection::ReadFixedResponseHeader(google::protobuf::io::CodedInputStream* input, size_t avail,
+                                            krpc::rpcResponseHeader* header, size_t* frame_size)
+{
+    if (avail < kKrpcFixedHeaderSize)   return 0;
+
+    char data[kKrpcFixedHeaderSize];
+    KrpcFixedHeader fixed;
+    if (!input->ReadRaw(data, sizeof(data)) || !KrpcDecodeFixedHeader(data, &fixed) || !(fixed.flags & kKrpcFlagResponse))
+    {
+        return -1;
+    }
+    if (fixed.body_length > static_cast<uint32_t>(INT_MAX) || fixed.meta_length > static_cast<uint32_t>(INT_MAX))    return -1;
+
+    *frame_size = kKrpcFixedHeaderSize + static_cast<size_t>(fixed.meta_length) + fixed.body_length;
+    if (avail < *frame_size)    return 0;
+
+    if (fixed.meta_length > 0)
+    {
+        google::protobuf::io::CodedInputStream::Limit limit = input->PushLimit(static_cast<int>(fixed.meta_length));
+        if (!header->ParseFromCodedStream(input))   return -1;
+        input->PopLimit(limit);
+    }
+
+    // 定长字段为准，meta 只用来带错误信息
+    header->set_request_id(fixed.request_id);
+    header->set_body_size(fixed.body_length);
+    header->set_error_code(krpc::rpcErrorCode_IsValid(fixed.error_code) ? static_cast<krpc::rpcErrorCode>(fixed.error_code)
+                                                                        : krpc::RPC_INTERNAL_ERROR);
+    return 1;
+}
+
+
+
+// 标记连接不可用，所有在途调用以失败结束
+void KrpcConnection::MarkBroken(const std::string& reason)
+{
+    KrpcPendingCall* pending = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_pendingMutex);
+        m_broken.store(true, std::memory_order_release);
+        m_inflight.fetch_sub(static_cast<int>(m_pending.Size()), std::memory_order_relaxed);
+        m_stats->inflight.fetch_sub(static_cast<int>(m_pending.Size()), std::memory_order_relaxed);
+        pending = m_pending.TakeAll();
+    }
+
+    // 在其他线程中出错时，shutdown 让 I/O 线程收到关闭事件，把连接从事件循环上注销
+    if (-1 != m_fd) shutdown(m_fd, SHUT_RDWR);
+
+    while (pending != nullptr)
+    {
+        KrpcPendingCall* call = pending;
+        pending = call->next; // Finish 可能释放 call，先取出下一个
+        KrpcTimerWheel::GetInstance().Cancel(&call->timer);
+        Finish(call, krpc::RPC_CONNECTION_LOST, reason);
+    }
+}
+
+
+
+// 结束一次调用
+void KrpcConnection::Finish(KrpcPendingCall* call, krpc::rpcErrorCode code, const std::string& errText)
+{
+    bool failed = (code != krpc::RPC_OK);
+
+    // 异步调用：失败原因写入 controller，释放调用记录后执行 done 回调
+    if (call->done != nullptr)
+    {
+        if (failed && call->controller != nullptr)  KrpcSetFailed(call->controller, code, errText);
+        google::protobuf::Closure* done = call->done;
+        std::shared_ptr<const KrpcRequestContext> context = std::move(call->context);
+        delete call;
+
+        // 配置了回调执行器时在工作线程中执行回调，执行器满了则退回到当前线程执行
+        // 回调里再发起的调用继承发起这次调用时的上下文（剩余时限、调用链id）
+        KrpcExecutor* executor = KrpcClientLoopPool::GetInstance().CallbackExecutor();
+        if (executor == nullptr || !executor->Submit([done, context]() {
+                KrpcRequestContext::Scope scope(context);
+                done->Run();
+            }))
+        {
+            KrpcRequestContext::Scope scope(std::move(context));
+            done->Run();
+        }
+        return;
+    }
+
+    // 同步调用：在持有锁的情况下通知，保证调用方被唤醒前 call 对象不会被销毁
+    std::lock_guard<std::mutex> lock(call->mutex);
+    call->finished = true;
+    call->failed = failed;
+    call->errorCode = code;
+    call->errText = errText;
+    call->cv.notify_all();
+}
@@ -0,0 +1,249 @@
+#include "krpcConnectionPool.h"
+#include "krpcApplication.h"
+#include "krpcLogger.h"
+#include "krpcThreadPool.h"
+
+#include <utility>
+#include <vector>
+
+
+// 获取全局唯一的连接池（局部静态变量，C++11 保证初始化线程安全，程序退出时自动析构并停止后台线程）
+KrpcConnectionPool& KrpcConnectionPool::GetInstance()
+{
+    static KrpcConnectionPool pool;
+    return pool;
+}
+
+
+// 所有 channel 共用两个建立连接的线程（局部静态变量，第一次用到时才创建），一个连接慢时另一个还能继续
+KrpcExecutor& KrpcConnectionPool::DialExecutor()
+{
+    static KrpcThreadPool executor(2, 4096);
+    return executor;
+}
+
+
+
+// 构造：从配置文件读取连接池参数，并启动后台回收线程
+KrpcConnectionPool::KrpcConnectionPool() : m_stop(false)
+{
+    KrpcConfig& config = KrpcApplication::GetConfig();
+    m_minSize = config.LoadInt("connpool_min_size", 0);
+    m_maxSize = config.LoadInt("connpool_max_size", 8);
+    m_maxInflight = config.LoadInt("connpool_max_inflight", 64);
+    m_idleTimeoutMs = config.LoadInt("connpool_idle_timeout_ms", 60000);
+    m_checkIntervalMs = config.LoadInt("connpool_check_interval_ms", 5000);
+    m_waitTimeoutMs = config.LoadInt("connpool_wait_timeout_ms", 3000);
+    m_connectTimeoutMs = config.LoadInt("connpool_connect_timeout_ms", 3000);
+
+    if (m_maxSize < 1)  m_maxSize = 1;
+    if (m_minSize > m_maxSize)  m_minSize = m_maxSize;
+
+    m_reaper = std::thread(&KrpcConnectionPool::ReapLoop, this);
+}
+
+
+// 析构：通知后台线程退出并等待其结束，剩余连接随 m_endpoints 一起关闭
+KrpcConnectionPool::~KrpcConnectionPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_stopCv.notify_all();
+    if (m_reaper.joinable())    m_reaper.join();
+}
+
+
+
+// 获取（不存在则创建）ip:port 对应的连接组，调用方需持有 m_mutex
+KrpcConnectionPool::Endpoint* KrpcConnectionPool::GetEndpoint(const std::string& ip, uint16_t port)
+{
+    // 每次调用都要查找连接组，键用线程本地的字符串拼接，保留容量，不为每次查找申请内存
+    static thread_local std::string key;
+    key.assign(ip);
+    key += ':';
+    key += std::to_string(port);
+    auto it = m_endpoints.find(key);
+    if (it != m_endpoints.end())    return it->second.get();
+
+    std::unique_ptr<Endpoint> ep(new Endpoint());
+    ep->ip = ip;
+    ep->port = port;
+    Endpoint* raw = ep.get();
+    m_endpoints.emplace(key, std::move(ep));
+    return raw;
+}
+
+
+
+// 从连接组中选出在途请求最少的可用连接，顺便把已断开的连接移到 broken 中（由调用方在锁外析构）
+std::shared_ptr<KrpcConnection> KrpcConnectionPool::PickLeastLoaded(Endpoint* ep, std::vector<std::shared_ptr<KrpcConnection>>* broken)
+{
+    std::shared_ptr<KrpcConnection> best;
+    for (auto it = ep->conns.begin(); it != ep->conns.end(); )
+    {
+        if ((*it)->IsBroken())
+        {
+            broken->push_back(*it);
+            it = ep->conns.erase(it);
+            continue;
+        }
+        if (!best || (*it)->InFlight() < best->InFlight())  best = *it;
+        ++it;
+    }
+    return best;
+}
+
+
+
+// 取得一条到 ip:port 的可用连接
+//   1. 有在途请求数没到 max_inflight 的连接，直接使用在途请求最少的那条
+//   2. 所有连接都比较忙且连接数没到上限，新建一条连接（connect 在锁外进行）；已达上限则继续复用最空闲的连接
+//   3. 还没有任何已建立的连接、且正在建立的连接数已达上限，等待连接建立，超时返回 nullptr
+std::shared_ptr<KrpcConnection> KrpcConnectionPool::Acquire(const std::string& ip, uint16_t port, int64_t timeout_ms,
+                                                            krpc::rpcErrorCode* errCode)
+{
+    // 调用的时限同时约束等待和建立连接，时限用完时报告超时，调用方据此区分超时和连接不上
+    auto start = std::chrono::steady_clock::now();
+    auto call_deadline = start + std::chrono::milliseconds(timeout_ms);
+    auto deadline = start + std::chrono::milliseconds(m_waitTimeoutMs);
+    if (timeout_ms > 0 && call_deadline < deadline)     deadline = call_deadline;
+    auto fail = [&]() -> std::shared_ptr<KrpcConnection> {
+        bool expired = (timeout_ms > 0 && std::chrono::steady_clock::now() >= call_deadline);
+        if (errCode != nullptr)     *errCode = expired ? krpc::RPC_DEADLINE_EXCEEDED : krpc::RPC_UNAVAILABLE;
+        return nullptr;
+    };
+
+    std::vector<std::shared_ptr<KrpcConnection>> broken; // 已断开的连接，在释放锁之后析构
+    std::unique_lock<std::mutex> lock(m_mutex);
+    Endpoint* ep = GetEndpoint(ip, port);
+
+    while (true)
+    {
+        std::shared_ptr<KrpcConnection> best = PickLeastLoaded(ep, &broken);
+        int total = static_cast<int>(ep->conns.size()) + ep->connecting;
+
+        if (best && (best->InFlight() < m_maxInflight || total >= m_maxSize))   return best;
+
+        if (total < m_maxSize)
+        {
+            int64_t budget_ms = 0;
+            if (timeout_ms > 0)
+            {
+                budget_ms = std::chrono::duration_cast<std::chrono::milliseconds>(call_deadline - std::chrono::steady_clock::now()).count();
+                if (budget_ms <= 0)     return best ? best : fail();
+            }
+
+            ep->connecting++; // 先占住名额，再到锁外建立连接
+            lock.unlock();
+
+            std::shared_ptr<KrpcConnection> conn = std::make_shared<KrpcConnection>(ip, port);
+            bool ok = conn->Connect(m_connectTimeoutMs, budget_ms);
+
+            lock.lock();
+            ep->connecting--;
+            if (ok) ep->conns.push_back(conn);
+            ep->cv.notify_all();
+
+            if (ok)     return conn;
+            if (best)   return best; // 新建失败，继续复用已有的连接
+            LOG(ERROR) << "connect " << ip << ":" << port << " failed";
+            return fail();
+        }
+
+        // 没有已建立的连接，等待正在建立的连接
+        if (ep->cv.wait_until(lock, deadline) == std::cv_status::timeout && ep->conns.empty())
+        {
+            LOG(ERROR) << "acquire connection to " << ip << ":" << port << " timeout";
+            return fail();
+        }
+    }
+}
+
+
+
+std::shared_ptr<KrpcConnection> KrpcConnectionPool::TryAcquire(const std::string& ip, uint16_t port)
+{
+    std::vector<std::shared_ptr<KrpcConnection>> broken; // 已断开的连接，在释放锁之后析构
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return PickLeastLoaded(GetEndpoint(ip, port), &broken);
+}
+
+
+
+// 后台线程：每隔 m_checkIntervalMs 执行一次回收
+void KrpcConnectionPool::ReapLoop()
+{
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_stopCv.wait_for(lock, std::chrono::milliseconds(m_checkIntervalMs), [this]{ return m_stop; });
+            if (m_stop) return;
+        }
+        ReapOnce();
+    }
+}
+
+
+void KrpcConnectionPool::ReapOnce()
+{
+    std::vector<std::shared_ptr<KrpcConnection>> expired;   // 待关闭的连接，在锁外析构
+    std::vector<std::pair<Endpoint*, int>> lacking;         // 需要补足的连接组及数量
+    auto now = std::chrono::steady_clock::now();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& item : m_endpoints)
+        {
+            Endpoint* ep = item.second.get();
+
+            // 已断开的连接，以及空闲超时（且超过最少连接数）的连接都回收
+            // 空闲连接要求没有在途请求，并且只被连接池和事件循环引用（没有调用方刚取走还没发送），
+            // 调用方只能在持有 m_mutex 时通过 Acquire 取得引用，所以这里的判断不会被并发打破
+            for (auto it = ep->conns.begin(); it != ep->conns.end(); )
+            {
+                bool idle = (*it)->InFlight() == 0 && it->use_count() <= 2
+                            && now - (*it)->LastActive() > std::chrono::milliseconds(m_idleTimeoutMs);
+                int total = static_cast<int>(ep->conns.size()) + ep->connecting;
+                if ((*it)->IsBroken() || (idle && total > m_minSize))
+                {
+                    expired.push_back(*it);
+                    it = ep->conns.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+
+            int lack = m_minSize - static_cast<int>(ep->conns.size()) - ep->connecting;
+            if (lack > 0)
+            {
+                ep->connecting += lack; // 先占住名额
+                lacking.emplace_back(ep, lack);
+            }
+        }
+    }
+
+    // 关闭回收的连接，从事件循环上注销后连接对象随最后一个引用释放
+    for (auto& conn : expired)  conn->Close();
+    expired.clear();
+
+    // 在锁外建立连接，补足每个服务端的最少连接数（Endpoint 创建后不会被删除，指针始终有效）
+    for (auto& item : lacking)
+    {
+        Endpoint* ep = item.first;
+        for (int i = 0; i < item.second; ++i)
+        {
+            std::shared_ptr<KrpcConnection> conn = std::make_shared<KrpcConnection>(ep->ip, ep->port);
+            bool ok = conn->Connect(m_connectTimeoutMs);
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            ep->connecting--;
+            if (ok) ep->conns.push_back(conn);
+            ep->cv.notify_all();
+        }
+    }
+}
@@ -1,16 +1,30 @@
 #include "krpcController.h"
+#include "krpcLoadBalancer.h"
 
-KrpcController::KrpcController()
+KrpcController::KrpcController() : m_canceled(false), m_cancelRequestId(0)
 {
     m_failed = false; // 初始状态为未失败
     m_errText = "";   // 初始错误信息为空
+    m_errorCode = krpc::RPC_OK;
+    m_hasRequestHash = false;
+    m_requestHash = 0;
+    m_timeoutMs = -1;
 }   
 
-// 重置控制器状态，失败标志和错误信息清空
-void KrpcController::Reaset()
+// 重置控制器状态，失败标志和错误信息清空（保留字符串容量，控制器可以反复复用）
+void KrpcController::Reset()
 {
-    m_failed = false;
-    m_errText = "";
+    ClearFailed();
+    m_hasRequestHash = false;
+    m_requestHash = 0;
+    m_timeoutMs = -1;
+
+    // 不在调用进行中时才能 Reset：调用已经结束，还没有执行的 NotifyOnCancel 回调在这里执行（回调执行后自行释放）
+    RunCancelCallbacks();
+    m_canceled.store(false, std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(m_cancelMutex);
+    m_cancelTarget.reset();
+    m_cancelRequestId = 0;
 }
 
 // 判断RPC调用是否失败
@@ -27,14 +41,106 @@ std::string KrpcController::ErrorText() const
 
 // 设置RPC调用失败，并记录失败原因
 void KrpcController::SetFailed(const std::string &reason)
+{
+    SetFailed(krpc::RPC_METHOD_FAILED, reason);
+}
+
+void KrpcController::SetFailed(krpc::rpcErrorCode code, const std::string& reason)
 {
     m_failed = true;
     m_errText = reason;
+    m_errorCode = code;
 }
 
+void KrpcController::ClearFailed()
+{
+    m_failed = false;
+    m_errText.clear();
+    m_errorCode = krpc::RPC_OK;
+}
+
+
+void KrpcSetFailed(google::protobuf::RpcController* controller, krpc::rpcErrorCode code, const std::string& reason)
+{
+    KrpcController* krpc_controller = dynamic_cast<KrpcController*>(controller);
+    if (krpc_controller != nullptr)     krpc_controller->SetFailed(code, reason);
+    else                                controller->SetFailed(reason);
+}
+
+
+// 设置一致性哈希路由的键
+void KrpcController::SetRequestKey(const std::string& key)
+{
+    SetRequestHash(KrpcHash64(key.data(), key.size()));
+}
+
+void KrpcController::SetRequestHash(uint64_t hash)
+{
+    m_hasRequestHash = true;
+    m_requestHash = hash;
+}
 
 
-// TODO 目前未实现的功能 
-void KrpcController::StartChannel() {}     // 开始取消RPC调用
-bool KrpcController::IsCanceled() const { return false; } // 判断RPC调用是否被取消
-void KrpcController::NotifyOnCancel(google::protobuf::Closure* callback) {} // 注册取消回调函数
\ No newline at end of file
+
+// 取消调用：客户端结束正在进行的调用并通知服务端，服务端执行 NotifyOnCancel 登记的回调；只有第一次生效
+void KrpcController::StartCancel()
+{
+    if (m_canceled.exchange(true))  return;
+
+    // 先设置标志再读取调用：SetCancelTarget 要么在这之前登记了调用，要么之后看到标志不再登记
+    std::shared_ptr<KrpcCancelable> target;
+    uint64_t request_id = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_cancelMutex);
+        target = m_cancelTarget.lock();
+        request_id = m_cancelRequestId;
+    }
+    if (target) target->Cancel(request_id, true); // 调用已经结束时什么也不做
+
+    RunCancelCallbacks();
+}
+
+// 判断RPC调用是否被取消
+bool KrpcController::IsCanceled() const
+{
+    return m_canceled.load(std::memory_order_acquire);
+}
+
+// 注册取消回调函数，已经取消时立即执行
+void KrpcController::NotifyOnCancel(google::protobuf::Closure* callback)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_cancelMutex);
+        if (!IsCanceled())
+        {
+            m_cancelCallbacks.push_back(callback);
+            return;
+        }
+    }
+    callback->Run();
+}
+
+
+bool KrpcController::SetCancelTarget(const std::shared_ptr<KrpcCancelable>& target, uint64_t request_id)
+{
+    std::lock_guard<std::mutex> lock(m_cancelMutex);
+    if (IsCanceled())   return false;
+    m_cancelTarget = target;
+    m_cancelRequestId = request_id;
+    return true;
+}
+
+
+// 回调在锁外执行，回调里可以再访问控制器
+void KrpcController::RunCancelCallbacks()
+{
+    std::vector<google::protobuf::Closure*> callbacks;
+    {
+        std::lock_guard<std::mutex> lock(m_cancelMutex);
+        callbacks.swap(m_cancelCallbacks);
+    }
+    for (google::protobuf::Closure* callback : callbacks)
+    {
+        callback->Run();
+    }
+}
\ No newline at end of file
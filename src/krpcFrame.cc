@@ -0,0 +1,85 @@
+#include "krpcFrame.h"
+
+#include <google/protobuf/io/coded_stream.h>
+
+#include <endian.h>
+#include <string.h>
+
+
+void KrpcEncodeFixedHeader(const KrpcFixedHeader& header, char* out)
+{
+    uint32_t magic = htole32(kKrpcFrameMagic);
+    uint16_t error_code = htole16(header.error_code);
+    uint32_t method_id = htole32(header.method_id);
+    uint64_t request_id = htole64(header.request_id);
+    uint32_t body_length = htole32(header.body_length);
+    uint32_t meta_length = htole32(header.meta_length);
+
+    memcpy(out, &magic, 4);
+    out[4] = static_cast<char>(kKrpcFrameVersion);
+    out[5] = static_cast<char>(header.flags);
+    memcpy(out + 6, &error_code, 2);
+    memcpy(out + 8, &method_id, 4);
+    memcpy(out + 12, &request_id, 8);
+    memcpy(out + 20, &body_length, 4);
+    memcpy(out + 24, &meta_length, 4);
+}
+
+
+bool KrpcDecodeFixedHeader(const char* data, KrpcFixedHeader* header)
+{
+    uint32_t magic = 0;
+    memcpy(&magic, data, 4);
+    if (le32toh(magic) != kKrpcFrameMagic || static_cast<uint8_t>(data[4]) != kKrpcFrameVersion)    return false;
+
+    uint16_t error_code = 0;
+    uint32_t method_id = 0, body_length = 0, meta_length = 0;
+    uint64_t request_id = 0;
+    memcpy(&error_code, data + 6, 2);
+    memcpy(&method_id, data + 8, 4);
+    memcpy(&request_id, data + 12, 8);
+    memcpy(&body_length, data + 20, 4);
+    memcpy(&meta_length, data + 24, 4);
+
+    header->flags = static_cast<uint8_t>(data[5]);
+    header->error_code = le16toh(error_code);
+    header->method_id = le32toh(method_id);
+    header->request_id = le64toh(request_id);
+    header->body_length = le32toh(body_length);
+    header->meta_length = le32toh(meta_length);
+    return true;
+}
+
+
+
+bool KrpcSerializeFrame(const google::protobuf::MessageLite& header, const google::protobuf::MessageLite* body, KrpcIOBuf* out)
+{
+    size_t header_size = header.ByteSizeLong();
+
+    KrpcIOBufOutputStream frame_output(out);
+    google::protobuf::io::CodedOutputStream coded_output(&frame_output);
+    coded_output.WriteVarint32(static_cast<uint32_t>(header_size)); // 写入头部长度
+    header.SerializeWithCachedSizes(&coded_output);                 // 写入头部信息
+    if (body != nullptr)
+    {
+        body->SerializeWithCachedSizes(&coded_output); // body 的长度已经由调用方计算并缓存
+    }
+    return !coded_output.HadError();
+}
+
+
+bool KrpcSerializeFixedFrame(KrpcFixedHeader header, const google::protobuf::MessageLite* meta,
+                             const google::protobuf::MessageLite* body, KrpcIOBuf* out)
+{
+    header.meta_length = (meta != nullptr) ? static_cast<uint32_t>(meta->ByteSizeLong()) : 0;
+
+    char fixed[kKrpcFixedHeaderSize];
+    KrpcEncodeFixedHeader(header, fixed);
+
+    KrpcIOBufOutputStream frame_output(out);
+    google::protobuf::io::CodedOutputStream coded_output(&frame_output);
+    coded_output.WriteRaw(fixed, sizeof(fixed));
+    if (meta != nullptr)    meta->SerializeWithCachedSizes(&coded_output);
+    if (body != nullptr)    body->SerializeWithCachedSizes(&coded_output);
+    return !coded_output.HadError();
+}
@@ -0,0 +1,100 @@
+#include "krpcHedgePolicy.h"
+#include "krpcApplication.h"
+
+
+std::unique_ptr<KrpcHedgePolicy> KrpcHedgePolicy::Create()
+{
+    KrpcConfig& config = KrpcApplication::GetConfig();
+    if (config.LoadInt("rpcclient_hedge", 0) != 1)     return nullptr;
+
+    int delay_ms = config.LoadInt("rpcclient_hedge_delay_ms", 0);
+    int percentile = config.LoadInt("rpcclient_hedge_percentile", 95);
+    int budget_percent = config.LoadInt("rpcclient_hedge_budget_percent", 5);
+    return std::unique_ptr<KrpcHedgePolicy>(new KrpcHedgePolicy(delay_ms, percentile, budget_percent));
+}
+
+
+KrpcHedgePolicy::KrpcHedgePolicy(int64_t delay_ms, int percentile, int budget_percent)
+    : m_delayMs(delay_ms > 0 ? delay_ms : 0),
+      m_percentile(percentile < 50 ? 50 : (percentile > 99 ? 99 : percentile)),
+      m_budget(budget_percent, false),
+      m_samples(0), m_percentileUs(-1)
+{
+    for (int i = 0; i < kBuckets; ++i)  m_buckets[i].store(0, std::memory_order_relaxed);
+}
+
+
+
+int64_t KrpcHedgePolicy::DelayMs() const
+{
+    if (m_delayMs > 0)  return m_delayMs;
+    int64_t percentile_us = m_percentileUs.load(std::memory_order_relaxed);
+    if (percentile_us < 0)  return -1;
+    return (percentile_us + 999) / 1000; // 向上取整，不早于分位数发出备份请求
+}
+
+
+
+// 小于 4us 的延迟各占一个桶；之后每个 [2^e, 2^(e+1)) 区间按最高的两位以下再分成 4 个桶，相对误差不超过 25%
+int KrpcHedgePolicy::BucketIndex(int64_t latency_us)
+{
+    if (latency_us < 4)     return latency_us < 0 ? 0 : static_cast<int>(latency_us);
+    int exp = 63 - __builtin_clzll(static_cast<unsigned long long>(latency_us));
+    int index = (exp - 1) * 4 + static_cast<int>((latency_us >> (exp - 2)) & 3);
+    return index < kBuckets ? index : kBuckets - 1;
+}
+
+
+int64_t KrpcHedgePolicy::BucketUpperBound(int index)
+{
+    if (index < 4)  return index;
+    int exp = index / 4 + 1;
+    int64_t lower = static_cast<int64_t>(4 + index % 4) << (exp - 2);
+    return lower + (static_cast<int64_t>(1) << (exp - 2)) - 1;
+}
+
+
+
+void KrpcHedgePolicy::RecordLatency(int64_t latency_us)
+{
+    m_buckets[BucketIndex(latency_us)].fetch_add(1, std::memory_order_relaxed);
+    if (m_samples.fetch_add(1, std::memory_order_relaxed) % kRecalcInterval == kRecalcInterval - 1)
+    {
+        Recalculate();
+    }
+}
+
+
+// 桶计数是各个线程并发更新的，算出来的分位数是近似值，足够决定什么时候发备份请求
+void KrpcHedgePolicy::Recalculate()
+{
+    uint64_t counts[kBuckets];
+    uint64_t total = 0;
+    for (int i = 0; i < kBuckets; ++i)
+    {
+        counts[i] = m_buckets[i].load(std::memory_order_relaxed);
+        total += counts[i];
+    }
+    if (total < kMinSamples)    return;
+
+    uint64_t rank = (total * static_cast<uint64_t>(m_percentile) + 99) / 100;
+    uint64_t seen = 0;
+    for (int i = 0; i < kBuckets; ++i)
+    {
+        seen += counts[i];
+        if (seen >= rank)
+        {
+            m_percentileUs.store(BucketUpperBound(i), std::memory_order_relaxed);
+            break;
+        }
+    }
+
+    // 衰减：旧样本的权重逐渐减小，服务端延迟变化后分位数很快跟上
+    if (total > kDecayThreshold)
+    {
+        for (int i = 0; i < kBuckets; ++i)
+        {
+            m_buckets[i].fetch_sub(static_cast<uint32_t>(counts[i] / 2), std::memory_order_relaxed);
+        }
+    }
+}
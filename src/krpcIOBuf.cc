@@ -0,0 +1,526 @@
+#include "krpcIOBuf.h"
+
+#include <errno.h>
+#include <string.h>
+#include <algorithm>
+#include <new>
+#include <vector>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+
+const size_t KrpcIOBuf::kDefaultBlockSize;
+const size_t KrpcIOBuf::kMaxBlockSize;
+const int KrpcIOBuf::kMaxIov;
+const size_t KrpcIOBuf::BlockRefQueue::kInlineRefs;
+
+
+// 内存块：头部之后紧跟 capacity 字节的数据区
+// size 只由唯一持有者（引用计数为 1 时）在末尾追加数据时修改，共享后内容不再变化
+struct KrpcIOBuf::Block
+{
+    std::atomic<int> ref;
+    uint32_t size;      // 已经写入的字节数
+    uint32_t capacity;  // 数据区大小
+
+    char* Data() { return reinterpret_cast<char*>(this + 1); }
+};
+
+
+
+// 线程本地的内存块缓存，只缓存默认大小的块
+// 进程退出时其他静态对象仍可能在析构中释放内存块，缓存析构之后直接释放，不再访问缓存
+namespace
+{
+
+const size_t kMaxCachedBlocks = 64; // 每个线程最多缓存的块数（64 * 8KB = 512KB）
+
+enum CacheState { kCacheUnused = 0, kCacheAlive = 1, kCacheDestroyed = 2 };
+thread_local int t_cacheState = kCacheUnused;
+
+struct BlockCache
+{
+    std::vector<void*> blocks;
+
+    BlockCache() { t_cacheState = kCacheAlive; }
+    ~BlockCache()
+    {
+        t_cacheState = kCacheDestroyed;
+        for (void* block : blocks)  ::operator delete(block);
+    }
+};
+
+thread_local BlockCache t_blockCache;
+
+} // namespace
+
+
+
+KrpcIOBuf::Block* KrpcIOBuf::AllocBlock(size_t capacity)
+{
+    void* mem = nullptr;
+    if (capacity == kDefaultBlockSize && t_cacheState != kCacheDestroyed && !t_blockCache.blocks.empty())
+    {
+        mem = t_blockCache.blocks.back();
+        t_blockCache.blocks.pop_back();
+    }
+    else
+    {
+        mem = ::operator new(sizeof(Block) + capacity);
+    }
+
+    Block* block = static_cast<Block*>(mem);
+    new (&block->ref) std::atomic<int>(1);
+    block->size = 0;
+    block->capacity = static_cast<uint32_t>(capacity);
+    return block;
+}
+
+
+void KrpcIOBuf::AddRef(Block* block)
+{
+    block->ref.fetch_add(1, std::memory_order_relaxed);
+}
+
+
+void KrpcIOBuf::Release(Block* block)
+{
+    if (block->ref.fetch_sub(1, std::memory_order_acq_rel) != 1)   return;
+
+    if (block->capacity == kDefaultBlockSize && t_cacheState != kCacheDestroyed && t_blockCache.blocks.size() < kMaxCachedBlocks)
+    {
+        t_blockCache.blocks.push_back(block);
+        return;
+    }
+    ::operator delete(block);
+}
+
+
+
+KrpcIOBuf::BlockRefQueue::BlockRefQueue(const BlockRefQueue& other)
+    : m_data(m_inline), m_capacity(kInlineRefs), m_head(0), m_count(0)
+{
+    for (size_t i = 0; i < other.m_count; ++i)  PushBack(other[i]);
+}
+
+
+void KrpcIOBuf::BlockRefQueue::TakeFrom(BlockRefQueue& other)
+{
+    if (other.m_data != other.m_inline)
+    {
+        // other 的引用在堆上，直接接管数组
+        if (m_data != m_inline)     delete[] m_data;
+        m_data = other.m_data;
+        m_capacity = other.m_capacity;
+        m_head = other.m_head;
+        m_count = other.m_count;
+        other.m_data = other.m_inline;
+        other.m_capacity = kInlineRefs;
+    }
+    else
+    {
+        Clear();
+        for (size_t i = 0; i < other.m_count; ++i)  PushBack(other[i]);
+    }
+    other.Clear();
+}
+
+
+// 容量翻倍，引用按顺序搬到新数组的开头
+void KrpcIOBuf::BlockRefQueue::Grow()
+{
+    size_t capacity = m_capacity * 2;
+    BlockRef* data = new BlockRef[capacity];
+    for (size_t i = 0; i < m_count; ++i)    data[i] = (*this)[i];
+    if (m_data != m_inline)     delete[] m_data;
+    m_data = data;
+    m_capacity = capacity;
+    m_head = 0;
+}
+
+
+
+KrpcIOBuf::KrpcIOBuf(const KrpcIOBuf& other) : m_refs(other.m_refs), m_size(other.m_size)
+{
+    for (size_t i = 0; i < m_refs.Size(); ++i)  AddRef(m_refs[i].block);
+}
+
+
+KrpcIOBuf& KrpcIOBuf::operator=(const KrpcIOBuf& other)
+{
+    if (this != &other)
+    {
+        KrpcIOBuf copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+
+KrpcIOBuf::KrpcIOBuf(KrpcIOBuf&& other) noexcept : m_size(other.m_size)
+{
+    m_refs.TakeFrom(other.m_refs);
+    other.m_size = 0;
+}
+
+
+KrpcIOBuf& KrpcIOBuf::operator=(KrpcIOBuf&& other) noexcept
+{
+    if (this != &other)
+    {
+        Clear();
+        m_refs.TakeFrom(other.m_refs);
+        m_size = other.m_size;
+        other.m_size = 0;
+    }
+    return *this;
+}
+
+
+void KrpcIOBuf::Clear()
+{
+    for (size_t i = 0; i < m_refs.Size(); ++i)  Release(m_refs[i].block);
+    m_refs.Clear();
+    m_size = 0;
+}
+
+
+
+size_t KrpcIOBuf::TailSpace(char** data)
+{
+    if (m_refs.Empty())     return 0;
+
+    BlockRef& tail = m_refs.Back();
+    Block* block = tail.block;
+    if (block->ref.load(std::memory_order_acquire) != 1)     return 0; // 被共享的块不能再写
+    if (tail.offset + tail.length != block->size)           return 0; // 后面的数据已经被切走或丢弃
+
+    *data = block->Data() + block->size;
+    return block->capacity - block->size;
+}
+
+
+void KrpcIOBuf::CommitTail(size_t len)
+{
+    BlockRef& tail = m_refs.Back();
+    tail.length += static_cast<uint32_t>(len);
+    tail.block->size += static_cast<uint32_t>(len);
+    m_size += len;
+}
+
+
+
+// 追加数据：先填满末尾块的剩余空间，再按剩余长度申请新块
+void KrpcIOBuf::Append(const void* data, size_t len)
+{
+    const char* src = static_cast<const char*>(data);
+    while (len > 0)
+    {
+        char* dst = nullptr;
+        size_t space = TailSpace(&dst);
+        if (space == 0)
+        {
+            size_t capacity = std::max(kDefaultBlockSize, std::min(len, kMaxBlockSize));
+            BlockRef ref = { AllocBlock(capacity), 0, 0 };
+            m_refs.PushBack(ref);
+            space = TailSpace(&dst);
+        }
+
+        size_t n = std::min(space, len);
+        memcpy(dst, src, n);
+        CommitTail(n);
+        src += n;
+        len -= n;
+    }
+}
+
+
+void KrpcIOBuf::Append(const KrpcIOBuf& other)
+{
+    if (&other == this)
+    {
+        KrpcIOBuf copy(other);
+        Append(std::move(copy));
+        return;
+    }
+    for (size_t i = 0; i < other.m_refs.Size(); ++i)
+    {
+        AddRef(other.m_refs[i].block);
+        m_refs.PushBack(other.m_refs[i]);
+    }
+    m_size += other.m_size;
+}
+
+
+void KrpcIOBuf::Append(KrpcIOBuf&& other)
+{
+    if (&other == this)     return Append(static_cast<const KrpcIOBuf&>(other));
+    for (size_t i = 0; i < other.m_refs.Size(); ++i)    m_refs.PushBack(other.m_refs[i]); // 引用的所有权直接转移
+    m_size += other.m_size;
+    other.m_refs.Clear();
+    other.m_size = 0;
+}
+
+
+
+size_t KrpcIOBuf::CutTo(KrpcIOBuf* out, size_t n)
+{
+    n = std::min(n, m_size);
+    size_t left = n;
+    while (left > 0)
+    {
+        BlockRef& front = m_refs.Front();
+        if (front.length <= left)
+        {
+            // 整个引用转移给 out
+            out->m_refs.PushBack(front);
+            left -= front.length;
+            m_refs.PopFront();
+        }
+        else
+        {
+            // 拆分引用：前半段给 out（增加一次引用计数），后半段留下
+            AddRef(front.block);
+            BlockRef head = { front.block, front.offset, static_cast<uint32_t>(left) };
+            out->m_refs.PushBack(head);
+            front.offset += static_cast<uint32_t>(left);
+            front.length -= static_cast<uint32_t>(left);
+            left = 0;
+        }
+    }
+    m_size -= n;
+    out->m_size += n;
+    return n;
+}
+
+
+size_t KrpcIOBuf::PopFront(size_t n)
+{
+    n = std::min(n, m_size);
+    size_t left = n;
+    while (left > 0)
+    {
+        BlockRef& front = m_refs.Front();
+        if (front.length <= left)
+        {
+            left -= front.length;
+            Release(front.block);
+            m_refs.PopFront();
+        }
+        else
+        {
+            front.offset += static_cast<uint32_t>(left);
+            front.length -= static_cast<uint32_t>(left);
+            left = 0;
+        }
+    }
+    m_size -= n;
+    return n;
+}
+
+
+
+size_t KrpcIOBuf::CopyTo(void* dst, size_t n, size_t pos) const
+{
+    char* out = static_cast<char*>(dst);
+    size_t copied = 0;
+    for (size_t i = 0; i < m_refs.Size(); ++i)
+    {
+        const BlockRef& ref = m_refs[i];
+        if (copied == n)    break;
+        if (pos >= ref.length)
+        {
+            pos -= ref.length;
+            continue;
+        }
+        size_t len = std::min(static_cast<size_t>(ref.length) - pos, n - copied);
+        memcpy(out + copied, ref.block->Data() + ref.offset + pos, len);
+        copied += len;
+        pos = 0;
+    }
+    return copied;
+}
+
+
+std::string KrpcIOBuf::ToString() const
+{
+    std::string result(m_size, '\0');
+    if (m_size > 0)     CopyTo(&result[0], m_size);
+    return result;
+}
+
+
+const char* KrpcIOBuf::BlockData(size_t i) const
+{
+    return m_refs[i].block->Data() + m_refs[i].offset;
+}
+
+
+
+ssize_t KrpcIOBuf::WriteToSocket(int fd, int* saved_errno)
+{
+    struct iovec iov[kMaxIov];
+    int iovcnt = 0;
+    for (size_t i = 0; i < m_refs.Size() && iovcnt < kMaxIov; ++i)
+    {
+        iov[iovcnt].iov_base = m_refs[i].block->Data() + m_refs[i].offset;
+        iov[iovcnt].iov_len = m_refs[i].length;
+        ++iovcnt;
+    }
+
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = iov;
+    msg.msg_iovlen = iovcnt;
+    ssize_t n = sendmsg(fd, &msg, MSG_NOSIGNAL); // 对端关闭时不触发 SIGPIPE
+    if (n < 0)
+    {
+        *saved_errno = errno;
+    }
+    else
+    {
+        PopFront(n);
+    }
+    return n;
+}
+
+
+
+// 读取数据：末尾块的剩余空间 + 若干个新的默认大小的块一起交给 readv，没用上的新块立即归还
+ssize_t KrpcIOBuf::ReadFromFd(int fd, size_t max_bytes, int* saved_errno)
+{
+    static const int kMaxReadBlocks = 16;
+
+    struct iovec iov[kMaxReadBlocks + 1];
+    Block* fresh[kMaxReadBlocks];
+    int iovcnt = 0;
+    int nfresh = 0;
+    size_t space = 0;
+
+    char* tail = nullptr;
+    size_t tail_space = TailSpace(&tail);
+    if (tail_space > 0)
+    {
+        iov[iovcnt].iov_base = tail;
+        iov[iovcnt].iov_len = tail_space;
+        ++iovcnt;
+        space += tail_space;
+    }
+    while (space < max_bytes && nfresh < kMaxReadBlocks)
+    {
+        Block* block = AllocBlock(kDefaultBlockSize);
+        fresh[nfresh++] = block;
+        iov[iovcnt].iov_base = block->Data();
+        iov[iovcnt].iov_len = block->capacity;
+        ++iovcnt;
+        space += block->capacity;
+    }
+
+    ssize_t n = readv(fd, iov, iovcnt);
+    if (n < 0)  *saved_errno = errno;
+
+    size_t left = (n > 0) ? static_cast<size_t>(n) : 0;
+    if (tail_space > 0)
+    {
+        size_t len = std::min(left, tail_space);
+        if (len > 0)    CommitTail(len);
+        left -= len;
+    }
+    for (int i = 0; i < nfresh; ++i)
+    {
+        if (left == 0)
+        {
+            Release(fresh[i]);
+            continue;
+        }
+        size_t len = std::min(left, static_cast<size_t>(fresh[i]->capacity));
+        fresh[i]->size = static_cast<uint32_t>(len);
+        BlockRef ref = { fresh[i], 0, static_cast<uint32_t>(len) };
+        m_refs.PushBack(ref);
+        m_size += len;
+        left -= len;
+    }
+    return n;
+}
+
+
+
+
+bool KrpcIOBufInputStream::Next(const void** data, int* size)
+{
+    while (m_index < m_buf.m_refs.Size() && m_offset == m_buf.m_refs[m_index].length)
+    {
+        ++m_index;
+        m_offset = 0;
+    }
+    if (m_index >= m_buf.m_refs.Size())     return false;
+
+    const KrpcIOBuf::BlockRef& ref = m_buf.m_refs[m_index];
+    *data = ref.block->Data() + ref.offset + m_offset;
+    *size = static_cast<int>(ref.length - m_offset);
+    m_byteCount += *size;
+    m_offset = ref.length;
+    return true;
+}
+
+
+// 只能退回上一次 Next 返回的数据，因此一定在当前块引用内
+void KrpcIOBufInputStream::BackUp(int count)
+{
+    m_offset -= count;
+    m_byteCount -= count;
+}
+
+
+bool KrpcIOBufInputStream::Skip(int count)
+{
+    while (count > 0)
+    {
+        if (m_index >= m_buf.m_refs.Size())     return false;
+        size_t left = m_buf.m_refs[m_index].length - m_offset;
+        if (static_cast<size_t>(count) < left)
+        {
+            m_offset += count;
+            m_byteCount += count;
+            return true;
+        }
+        count -= static_cast<int>(left);
+        m_byteCount += left;
+        ++m_index;
+        m_offset = 0;
+    }
+    return true;
+}
+
+
+
+
+// 交出末尾块的剩余空间；没有时申请新块，新块大小随已写入的数据量翻倍增长
+bool KrpcIOBufOutputStream::Next(void** data, int* size)
+{
+    char* dst = nullptr;
+    size_t space = m_buf->TailSpace(&dst);
+    if (space == 0)
+    {
+        size_t capacity = std::max(KrpcIOBuf::kDefaultBlockSize, std::min(static_cast<size_t>(m_byteCount), KrpcIOBuf::kMaxBlockSize));
+        KrpcIOBuf::BlockRef ref = { KrpcIOBuf::AllocBlock(capacity), 0, 0 };
+        m_buf->m_refs.PushBack(ref);
+        space = m_buf->TailSpace(&dst);
+    }
+
+    m_buf->CommitTail(space); // 先把整块空间都算作已写入，没用完的部分由 BackUp 退回
+    *data = dst;
+    *size = static_cast<int>(space);
+    m_byteCount += space;
+    return true;
+}
+
+
+void KrpcIOBufOutputStream::BackUp(int count)
+{
+    KrpcIOBuf::BlockRef& tail = m_buf->m_refs.Back();
+    tail.length -= count;
+    tail.block->size -= count;
+    m_buf->m_size -= count;
+    m_byteCount -= count;
+}
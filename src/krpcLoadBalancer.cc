@@ -0,0 +1,260 @@
+#include "krpcLoadBalancer.h"
+#include "krpcController.h"
+#include "krpcLogger.h"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+
+void KrpcEndpointStats::Record(int64_t latency_us)
+{
+    if (latency_us < 1)     latency_us = 1;
+
+    // 新样本占 1/8 的权重，多个 I/O 线程同时更新时用 CAS，不丢样本
+    int64_t old = ewmaLatencyUs.load(std::memory_order_relaxed);
+    int64_t next;
+    do
+    {
+        next = (old == 0) ? latency_us : old + (latency_us - old) / 8;
+        if (next < 1)   next = 1;
+    } while (!ewmaLatencyUs.compare_exchange_weak(old, next, std::memory_order_relaxed));
+}
+
+
+std::shared_ptr<KrpcEndpointStats> KrpcEndpointStats::Get(const std::string& ip, uint16_t port)
+{
+    static std::mutex mutex;
+    static std::unordered_map<std::string, std::shared_ptr<KrpcEndpointStats>> stats; // "ip:port" -> 统计
+
+    std::string key = ip + ":" + std::to_string(port);
+    std::lock_guard<std::mutex> lock(mutex);
+    std::shared_ptr<KrpcEndpointStats>& entry = stats[key];
+    if (!entry)     entry = std::make_shared<KrpcEndpointStats>();
+    return entry;
+}
+
+
+
+// splitmix64 的混合函数，把相近的输入（如连续的整数键）打散到整个 64 位空间
+static uint64_t Mix64(uint64_t x)
+{
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+
+uint64_t KrpcHash64(const void* data, size_t len)
+{
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < len; ++i)
+    {
+        hash ^= p[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return Mix64(hash);
+}
+
+
+
+// 当前线程的 xorshift 随机数，各个线程的种子不同，不需要加锁
+static uint32_t NextRandom()
+{
+    static thread_local uint32_t state = 0;
+    if (state == 0)
+    {
+        size_t seed = std::hash<std::thread::id>()(std::this_thread::get_id())
+                      ^ static_cast<size_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+        state = static_cast<uint32_t>(seed) | 1;
+    }
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+
+
+// 轮询
+class KrpcRoundRobinBalancer : public KrpcLoadBalancer
+{
+public:
+    KrpcRoundRobinBalancer() : m_next(0) {}
+
+    size_t Select(const KrpcServiceInstanceListPtr& list, const KrpcController* controller) override
+    {
+        const KrpcServiceInstanceList& instances = *list;
+        return m_next.fetch_add(1, std::memory_order_relaxed) % instances.size();
+    }
+
+private:
+    std::atomic<uint64_t> m_next;
+};
+
+
+
+// 按权重随机：实例数一般不多，直接按前缀和扫描
+class KrpcWeightedRandomBalancer : public KrpcLoadBalancer
+{
+public:
+    size_t Select(const KrpcServiceInstanceListPtr& list, const KrpcController* controller) override
+    {
+        const KrpcServiceInstanceList& instances = *list;
+        uint64_t total = 0;
+        for (const KrpcServiceInstance& instance : instances)   total += static_cast<uint64_t>(instance.weight);
+        if (total == 0)     return NextRandom() % instances.size();
+
+        uint64_t point = NextRandom() % total;
+        for (size_t i = 0; i < instances.size(); ++i)
+        {
+            uint64_t weight = static_cast<uint64_t>(instances[i].weight);
+            if (point < weight)     return i;
+            point -= weight;
+        }
+        return instances.size() - 1;
+    }
+};
+
+
+
+// 在途请求最少：从随机位置开始扫描，在途请求数相同时不总是落到第一个实例上
+class KrpcLeastRequestBalancer : public KrpcLoadBalancer
+{
+public:
+    size_t Select(const KrpcServiceInstanceListPtr& list, const KrpcController* controller) override
+    {
+        const KrpcServiceInstanceList& instances = *list;
+        size_t n = instances.size();
+        size_t start = NextRandom() % n;
+        size_t best = start;
+        int best_inflight = instances[start].stats->inflight.load(std::memory_order_relaxed);
+        for (size_t i = 1; i < n && best_inflight > 0; ++i)
+        {
+            size_t idx = (start + i) % n;
+            int inflight = instances[idx].stats->inflight.load(std::memory_order_relaxed);
+            if (inflight < best_inflight)
+            {
+                best = idx;
+                best_inflight = inflight;
+            }
+        }
+        return best;
+    }
+};
+
+
+
+// 二选一（power of two choices）：随机选两个不同的实例，比较 EWMA 延迟 * (在途请求数 + 1)
+// 不需要扫描全部实例，又能避开慢实例和积压的实例；还没有延迟样本的实例代价最小，新上线的实例会先被探测
+class KrpcP2CBalancer : public KrpcLoadBalancer
+{
+public:
+    size_t Select(const KrpcServiceInstanceListPtr& list, const KrpcController* controller) override
+    {
+        const KrpcServiceInstanceList& instances = *list;
+        size_t n = instances.size();
+        if (n == 1)     return 0;
+
+        size_t a = NextRandom() % n;
+        size_t b = NextRandom() % (n - 1);
+        if (b >= a)     ++b;
+        return (Cost(instances[b]) < Cost(instances[a])) ? b : a;
+    }
+
+private:
+    static double Cost(const KrpcServiceInstance& instance)
+    {
+        int64_t latency = instance.stats->ewmaLatencyUs.load(std::memory_order_relaxed);
+        int inflight = instance.stats->inflight.load(std::memory_order_relaxed);
+        return static_cast<double>(latency + 1) * (inflight + 1);
+    }
+};
+
+
+
+// 一致性哈希：每个实例按权重在哈希环上放若干个虚拟节点，键落在环上顺时针遇到的第一个虚拟节点所属的实例
+// 实例列表变化（channel 从服务发现缓存拿到新列表）时重建哈希环，只有原来落在变化实例上的键会换实例
+class KrpcConsistentHashBalancer : public KrpcLoadBalancer
+{
+public:
+    static const int kVirtualNodes = 160;   // 默认权重的实例在环上的虚拟节点数
+    static const int kMaxVirtualNodes = 10 * kVirtualNodes; // 一个实例最多的虚拟节点数，权重再大也不会让环无限膨胀
+
+    KrpcConsistentHashBalancer() : m_next(0) {}
+
+    size_t Select(const KrpcServiceInstanceListPtr& list, const KrpcController* controller) override
+    {
+        if (controller == nullptr || !controller->HasRequestHash())
+        {
+            return m_next.fetch_add(1, std::memory_order_relaxed) % list->size(); // 没有设置键，按轮询
+        }
+
+        // 哈希环与实例列表一一对应，环里持有列表的引用，列表地址不会被复用，按地址比较即可判断列表是否变化
+        std::shared_ptr<const Ring> ring = std::atomic_load(&m_ring);
+        if (!ring || ring->instances != list)
+        {
+            ring = Build(list);
+            std::atomic_store(&m_ring, ring);
+        }
+
+        uint64_t point = Mix64(controller->RequestHash());
+        auto it = std::lower_bound(ring->points.begin(), ring->points.end(), std::make_pair(point, static_cast<uint32_t>(0)));
+        if (it == ring->points.end())   it = ring->points.begin(); // 绕回环的起点
+        return it->second;
+    }
+
+private:
+    struct Ring
+    {
+        KrpcServiceInstanceListPtr instances;
+        std::vector<std::pair<uint64_t, uint32_t>> points; // (虚拟节点哈希, 实例下标)，按哈希排序
+    };
+
+    std::atomic<uint64_t> m_next;
+    std::shared_ptr<const Ring> m_ring; // 用 std::atomic_load / atomic_store 读写
+
+    // 虚拟节点的哈希只取决于实例的 ip:port 和序号，与实例在列表中的位置无关，其他实例上下线时不会移动
+    static std::shared_ptr<const Ring> Build(const KrpcServiceInstanceListPtr& list)
+    {
+        std::shared_ptr<Ring> ring = std::make_shared<Ring>();
+        ring->instances = list;
+        std::string name;
+        for (size_t i = 0; i < list->size(); ++i)
+        {
+            const KrpcServiceInstance& instance = (*list)[i];
+            int64_t vnodes = static_cast<int64_t>(kVirtualNodes) * instance.weight / kKrpcDefaultWeight;
+            if (vnodes < 1)     vnodes = 1;
+            if (vnodes > kMaxVirtualNodes)  vnodes = kMaxVirtualNodes;
+            for (int64_t v = 0; v < vnodes; ++v)
+            {
+                name = instance.ip + ":" + std::to_string(instance.port) + "#" + std::to_string(v);
+                ring->points.emplace_back(KrpcHash64(name.data(), name.size()), static_cast<uint32_t>(i));
+            }
+        }
+        std::sort(ring->points.begin(), ring->points.end());
+        return ring;
+    }
+};
+
+
+
+std::unique_ptr<KrpcLoadBalancer> KrpcLoadBalancer::Create(const std::string& name)
+{
+    if (name == "random")       return std::unique_ptr<KrpcLoadBalancer>(new KrpcWeightedRandomBalancer());
+    if (name == "leastrequest") return std::unique_ptr<KrpcLoadBalancer>(new KrpcLeastRequestBalancer());
+    if (name == "p2c")          return std::unique_ptr<KrpcLoadBalancer>(new KrpcP2CBalancer());
+    if (name == "consistenthash")   return std::unique_ptr<KrpcLoadBalancer>(new KrpcConsistentHashBalancer());
+    if (!name.empty() && name != "roundrobin")
+    {
+        LOG(WARNING) << "unknown load balancer " << name << ", use roundrobin";
+    }
+    return std::unique_ptr<KrpcLoadBalancer>(new KrpcRoundRobinBalancer());
+}
@@ -0,0 +1,546 @@
+#include "krpcProvider.h"
+#include "krpcApplication.h"
+#include "krpcArenaPool.h"
+#include "krpcHeader.pb.h"
+#include "krpcClosure.h"
+#include "krpcFrame.h"
+#include "krpcLoadBalancer.h"
+#include "krpcLogger.h"
+#include "krpcRequestContext.h"
+#include "krpcThreadPool.h"
+#include "krpcWorkStealingExecutor.h"
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+
+// 发布 RPC 服务：记录服务对象及其所有方法，供 OnMessage 根据 服务名 + 方法名 找到要调用的方法
+void KrpcProvider::NotifyService(google::protobuf::Service *service)
+{
+    ServiseInfo service_info;
+
+    // 通过反射获取服务对象的描述信息（服务名、方法数量、每个方法的描述）
+    const google::protobuf::ServiceDescriptor* psd = service->GetDescriptor();
+    std::string service_name = psd->name();
+    int method_count = psd->method_count();
+
+    std::cout << "service_name: " << service_name << std::endl;
+
+    for (int i = 0; i < method_count; ++i)
+    {
+        const google::protobuf::MethodDescriptor* pmd = psd->method(i);
+        std::string method_name = pmd->name();
+        std::cout << "method_name: " << method_name << std::endl;
+        service_info.method_map.emplace(method_name, pmd); // 方法名 -> 方法描述
+        method_table.push_back(MethodEntry{service, pmd});  // 方法编号为在 method_table 中的下标 + 1
+    }
+    service_info.service = service;
+    service_map.emplace(service_name, service_info); // 服务名 -> 服务对象 + 方法表
+}
+
+
+
+// 启动RPC服务节点：启动 muduo 网络服务，并把发布的服务方法注册到 zookeeper
+void KrpcProvider::Run()
+{
+    // 读取配置文件中 rpc 服务端的 ip 和 port
+    std::string ip = KrpcApplication::GetInstance().GetConfig().Load("rpcserverip");
+    int port = atoi(KrpcApplication::GetInstance().GetConfig().Load("rpcserverport").c_str());
+
+    // 创建 TcpServer
+    muduo::net::InetAddress address(ip, port);
+    std::shared_ptr<muduo::net::TcpServer> server = std::make_shared<muduo::net::TcpServer>(&event_loop, address, "KrpcProvider");
+
+    // 握手时发给客户端的方法表，顺序与 method_table 一致
+    for (const MethodEntry& entry : method_table)
+    {
+        handshake_response.add_methods(entry.method->full_name());
+    }
+
+    // 配置项 rpcserver_frame_version：允许与客户端协商的固定帧头最高版本，默认为当前版本；配置为 0 时只使用 protobuf 帧头
+    int frame_version = KrpcApplication::GetInstance().GetConfig().LoadInt("rpcserver_frame_version", static_cast<int>(kKrpcFrameVersion));
+    max_frame_version = (frame_version > 0) ? static_cast<uint32_t>(frame_version) : 0;
+
+    // 多 Reactor：event_loop 作为主 Reactor 只负责 accept，新连接轮询分给 io_threads 个子 Reactor（各自一个线程 + EventLoop），
+    // 连接上的读、解析、调用服务方法、发送响应都在所属子 Reactor 的线程中完成
+    // 配置项 rpcserver_io_threads：子 Reactor 个数，默认等于 CPU 核数；配置为 0 时退化为单线程，所有工作都在主 Reactor 中完成
+    int default_threads = static_cast<int>(std::thread::hardware_concurrency());
+    int io_threads = KrpcApplication::GetInstance().GetConfig().LoadInt("rpcserver_io_threads", default_threads > 0 ? default_threads : 1);
+    if (io_threads < 0)  io_threads = 0;
+    server->setThreadNum(io_threads);
+
+    // 绑定连接回调和消息回调，分离网络连接业务和消息处理业务
+    server->setConnectionCallback(std::bind(&KrpcProvider::OnConnection, this, std::placeholders::_1));
+    server->setMessageCallback(std::bind(&KrpcProvider::OnMessage, this, std::placeholders::_1,
+                                         std::placeholders::_2, std::placeholders::_3));
+
+    // 把当前节点发布的服务全部注册到 zookeeper 上，客户端可以从 zookeeper 上发现服务
+    // 节点路径："/服务名"、"/服务名/方法名"（永久节点）和 "/服务名/方法名/ip:port"（临时节点，服务端下线后自动删除）
+    // 同一个服务可以由多个服务端提供，每个服务端在方法节点下各注册一个实例节点，节点数据为权重
+    // 配置项 rpcserver_weight：本节点的权重，客户端按权重随机选择实例时使用，默认 100
+    int weight = KrpcApplication::GetInstance().GetConfig().LoadInt("rpcserver_weight", kKrpcDefaultWeight);
+    if (weight <= 0)    weight = kKrpcDefaultWeight;
+    if (weight > kKrpcMaxWeight)    weight = kKrpcMaxWeight;
+    std::string instance_name = ip + ":" + std::to_string(port);
+    std::string instance_data = std::to_string(weight);
+
+    ZkClient zkclient; // zkclient 的会话要和服务端存活时间一致，临时节点才不会被删除
+    zkclient.Start();
+    for (auto& sp : service_map)
+    {
+        std::string service_path = "/" + sp.first;
+        zkclient.Create(service_path.c_str(), nullptr, 0);
+        for (auto& mp : sp.second.method_map)
+        {
+            std::string method_path = service_path + "/" + mp.first;
+            zkclient.Create(method_path.c_str(), nullptr, 0);
+            std::string instance_path = method_path + "/" + instance_name;
+            zkclient.Create(instance_path.c_str(), instance_data.c_str(), static_cast<int>(instance_data.size()), ZOO_EPHEMERAL);
+        }
+    }
+
+    // 业务线程池：服务方法在工作线程中执行，I/O 线程只负责收发和解析
+    // 配置项 rpcserver_worker_threads：工作线程数，默认等于 CPU 核数；配置为 0 时不使用线程池，服务方法直接在 I/O 线程中执行
+    // 配置项 rpcserver_worker_queue_size：等待执行的请求数上限，默认 65536，超过后新请求直接返回 RPC_SERVER_BUSY
+    // 配置项 rpcserver_executor：workstealing（默认，每个工作线程一个本地队列 + 任务窃取）或 threadpool（所有线程共享一个队列）
+    int worker_threads = KrpcApplication::GetInstance().GetConfig().LoadInt("rpcserver_worker_threads", default_threads > 0 ? default_threads : 1);
+    int queue_size = KrpcApplication::GetInstance().GetConfig().LoadInt("rpcserver_worker_queue_size", 65536);
+    if (queue_size <= 0)    queue_size = 65536;
+    if (worker_threads > 0)
+    {
+        if (KrpcApplication::GetInstance().GetConfig().Load("rpcserver_executor") == "threadpool")
+        {
+            worker_pool.reset(new KrpcThreadPool(worker_threads, queue_size));
+        }
+        else
+        {
+            worker_pool.reset(new KrpcWorkStealingExecutor(worker_threads, queue_size));
+        }
+    }
+
+    std::cout << "RpcProvider start service at ip: " << ip << " port: " << port
+              << " io threads: " << io_threads << " worker threads: " << worker_threads << std::endl;
+
+    // 启动网络服务，进入事件循环
+    server->start();
+    event_loop.loop();
+}
+
+
+
+// 连接回调：新连接创建连接状态；连接断开时关闭连接，还在处理的请求都当作被取消（客户端已经收不到响应了）
+void KrpcProvider::OnConnection(const muduo::net::TcpConnectionPtr &conn)
+{
+    if (conn->connected())
+    {
+        conn->setContext(std::make_shared<ConnectionState>());
+        return;
+    }
+
+    conn->shutdown();
+    ConnectionState* state = State(conn);
+    if (state == nullptr)   return;
+    std::vector<std::shared_ptr<KrpcController>> controllers;
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        for (auto& entry : state->active)   controllers.push_back(entry.second);
+    }
+    for (const std::shared_ptr<KrpcController>& controller : controllers)
+    {
+        controller->StartCancel();
+    }
+}
+
+
+
+/*
+    收到客户端数据的回调，请求帧格式（由连接建立时的握手协商，见 krpcFrame.h）：
+        【header长度(varint)】+【rpcHeader（服务名 + 方法名 或 方法编号 + 参数长度 + 请求id）】+【参数 args】
+        【固定帧头（方法编号 + 请求id + 参数长度 + meta长度）】+【meta（可选的 rpcHeader）】+【参数 args】
+    TCP 是字节流，一次回调可能包含多个请求帧，也可能只有半个请求帧，
+    所以循环拆出所有完整的请求帧，不完整的数据留在 buffer 中等待下一次回调
+*/
+void KrpcProvider::OnMessage(const muduo::net::TcpConnectionPtr &conn, muduo::net::Buffer *buffer, muduo::Timestamp receive_time)
+{
+    uint32_t frame_version = FrameVersion(conn);
+    while (buffer->readableBytes() > 0)
+    {
+        // 1~3. 直接在 buffer 的可读区域上解析帧头，参数部分同样留在 buffer 中，
+        //      反序列化完成（或确定不需要反序列化）后再消费掉整帧
+        RequestFrame frame;
+        int ret = (frame_version != 0) ? ParseFixedRequestFrame(buffer->peek(), buffer->readableBytes(), &frame)
+                                       : ParseRequestFrame(buffer->peek(), buffer->readableBytes(), &frame);
+        if (ret < 0)
+        {
+            LOG(ERROR) << "invalid request frame";
+            conn->shutdown();
+            return;
+        }
+        if (ret == 0)   return; // 还没收全
+
+        const char* args_data = frame.args_data;
+        int args_size = frame.args_size;
+        size_t frame_size = frame.frame_size;
+        uint64_t request_id = frame.request_id;
+
+        // 客户端取消了之前的一个请求，通知它的控制器，取消帧不回复
+        if (frame.cancel)
+        {
+            buffer->retrieve(frame_size);
+            HandleCancel(conn, request_id);
+            continue;
+        }
+
+        // 4. 查找服务对象和方法描述，找不到时给客户端回错误码，连接继续处理后面的请求
+        //    握手之后的请求带方法编号，直接按下标取方法表；否则按 服务名 + 方法名 查找
+        google::protobuf::Service* service = nullptr;
+        const google::protobuf::MethodDescriptor* method = nullptr;
+        uint32_t method_id = frame.method_id;
+        if (method_id != 0)
+        {
+            if (method_id > method_table.size())
+            {
+                LOG(ERROR) << "method id " << method_id << " is not exist!";
+                buffer->retrieve(frame_size);
+                SendRpcError(conn, request_id, krpc::RPC_NO_METHOD, "method id " + std::to_string(method_id) + " is not exist");
+                continue;
+            }
+            service = method_table[method_id - 1].service;
+            method = method_table[method_id - 1].method;
+        }
+        else
+        {
+            const std::string& service_name = frame.header.service_name();
+            const std::string& method_name = frame.header.method_name();
+
+            if (service_name == kKrpcHandshakeService && frame_version == 0)
+            {
+                HandleHandshake(conn, frame);
+                buffer->retrieve(frame_size);
+                frame_version = FrameVersion(conn); // 握手之后的数据按协商好的帧头解析
+                continue;
+            }
+
+            auto it = service_map.find(service_name);
+            if (it == service_map.end())
+            {
+                LOG(ERROR) << service_name << " is not exist!";
+                buffer->retrieve(frame_size);
+                SendRpcError(conn, request_id, krpc::RPC_NO_SERVICE, service_name + " is not exist");
+                continue;
+            }
+            auto mit = it->second.method_map.find(method_name);
+            if (mit == it->second.method_map.end())
+            {
+                LOG(ERROR) << service_name << "." << method_name << " is not exist!";
+                buffer->retrieve(frame_size);
+                SendRpcError(conn, request_id, krpc::RPC_NO_METHOD, service_name + "." + method_name + " is not exist");
+                continue;
+            }
+            service = it->second.service;
+            method = mit->second;
+        }
+
+        // 5. 在本次调用专用的 Arena 上生成请求和响应对象（包括所有子消息），直接从 buffer 中反序列化请求参数，然后消费掉这一帧
+        google::protobuf::Arena* arena = KrpcArenaPool::Acquire();
+        google::protobuf::Message* request = service->GetRequestPrototype(method).New(arena);
+        bool parsed = request->ParseFromArray(args_data, args_size);
+        buffer->retrieve(frame_size);
+        if (!parsed)
+        {
+            LOG(ERROR) << method->full_name() << " request parse error";
+            KrpcArenaPool::Release(arena);
+            SendRpcError(conn, request_id, krpc::RPC_BAD_REQUEST, "request parse error");
+            continue;
+        }
+        google::protobuf::Message* response = service->GetResponsePrototype(method).New(arena);
+
+        // 6. 服务端的控制器登记在连接上，客户端取消调用或连接断开时通过它通知服务方法（IsCanceled / NotifyOnCancel）
+        std::shared_ptr<KrpcController> controller = std::make_shared<KrpcController>();
+        {
+            ConnectionState* state = State(conn);
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->active[request_id] = controller;
+        }
+
+        // 7. 绑定 done 回调：服务方法执行完后发送响应，然后把 Arena 还回池中，请求和响应对象随之一起释放
+        //    （响应在 SendRpcResponse 中已经序列化进发送缓冲区，之后不再访问）
+        //    已经取消的请求客户端不再等待，不发送响应；服务方法调用了 controller->SetFailed 时回复失败原因
+        google::protobuf::Closure* done = new KrpcClosure([this, conn, request_id, response, arena, controller]() {
+            RemoveActive(conn, request_id);
+            if (!controller->IsCanceled())
+            {
+                if (controller->Failed())   SendRpcError(conn, request_id, krpc::RPC_METHOD_FAILED, controller->ErrorTextRef());
+                else                        SendRpcResponse(conn, request_id, response);
+            }
+            controller->RunCancelCallbacks(); // 没有被取消时，NotifyOnCancel 登记的回调在处理结束后执行
+            KrpcArenaPool::Release(arena);
+        });
+
+        // 8. 本次请求的调用上下文：截止时间从收到请求时开始计算，链路信息取自请求头
+        //    服务方法执行期间安装在当前线程上，方法中发起的下游调用继承剩余时限和调用链id（见 krpcRequestContext.h）
+        std::shared_ptr<const KrpcRequestContext> context = std::make_shared<KrpcRequestContext>(
+            frame.header.timeout_ms(), frame.header.trace_id(), frame.header.parent_span_id());
+
+        // 9. 调用服务方法，服务方法中执行 done->Run() 把响应发回客户端
+        //    配置了业务线程池时交给工作线程执行，慢方法不会阻塞同一个 I/O 线程上的其他连接
+        if (!worker_pool)
+        {
+            KrpcRequestContext::Scope scope(std::move(context));
+            service->CallMethod(method, controller.get(), request, response, done);
+            continue;
+        }
+        // 工作线程开始执行前已经超时的请求不再执行（客户端已经放弃等待），直接回错误；排队期间被取消的请求也不再执行
+        bool submitted = worker_pool->Submit([this, conn, request_id, arena, context, controller, service, method, request, response, done]() {
+            if (context->Expired())
+            {
+                LOG(WARNING) << method->full_name() << " dropped, deadline exceeded before execution";
+                RemoveActive(conn, request_id);
+                delete done;
+                KrpcArenaPool::Release(arena);
+                SendRpcError(conn, request_id, krpc::RPC_DEADLINE_EXCEEDED, "deadline exceeded");
+                return;
+            }
+            if (controller->IsCanceled())
+            {
+                done->Run(); // 不回复，只做清理
+                return;
+            }
+            KrpcRequestContext::Scope scope(context);
+            service->CallMethod(method, controller.get(), request, response, done);
+        });
+        if (!submitted)
+        {
+            // 队列已满，说明业务线程处理不过来，直接拒绝，让客户端尽快失败而不是无限排队
+            LOG(ERROR) << method->full_name() << " rejected, worker queue is full";
+            RemoveActive(conn, request_id);
+            delete done;
+            KrpcArenaPool::Release(arena);
+            SendRpcError(conn, request_id, krpc::RPC_SERVER_BUSY, "server busy");
+        }
+    }
+}
+
+
+
+// 序列化响应并发送，响应头中带回请求id，客户端据此找到对应的调用
+void KrpcProvider::SendRpcResponse(const muduo::net::TcpConnectionPtr &conn, uint64_t request_id, google::protobuf::Message *response)
+{
+    size_t body_size = response->ByteSizeLong(); // 计算并缓存各字段的序列化长度，组帧时按缓存的长度直接写入
+    if (body_size > static_cast<size_t>(INT_MAX))
+    {
+        LOG(ERROR) << "serialize response error, response too large: " << body_size;
+        SendRpcError(conn, request_id, krpc::RPC_INTERNAL_ERROR, "serialize response error");
+        return;
+    }
+
+    krpc::rpcResponseHeader response_header;
+    response_header.set_request_id(request_id);
+    response_header.set_body_size(static_cast<uint32_t>(body_size));
+    response_header.set_error_code(krpc::RPC_OK);
+    SendResponseFrame(conn, response_header, response);
+}
+
+
+
+// 回一个只带错误码和错误信息的响应，body 为空
+void KrpcProvider::SendRpcError(const muduo::net::TcpConnectionPtr &conn, uint64_t request_id, krpc::rpcErrorCode error_code, const std::string &error_text)
+{
+    krpc::rpcResponseHeader response_header;
+    response_header.set_request_id(request_id);
+    response_header.set_body_size(0);
+    response_header.set_error_code(error_code);
+    response_header.set_error_text(error_text);
+    SendResponseFrame(conn, response_header, nullptr);
+}
+
+
+
+// 解析 protobuf 帧头的请求帧：【header长度(varint)】+【rpcHeader】+【参数 args】
+int KrpcProvider::ParseRequestFrame(const char* data, size_t len, RequestFrame* frame)
+{
+    // 读取 header 长度
+    google::protobuf::io::ArrayInputStream array_input(data, static_cast<int>(len));
+    google::protobuf::io::CodedInputStream coded_input(&array_input);
+    uint32_t header_size = 0;
+    if (!coded_input.ReadVarint32(&header_size))
+    {
+        return (len >= 5) ? -1 : 0; // varint32 最多5个字节，读不出来说明数据格式错误
+    }
+    size_t varint_size = coded_input.CurrentPosition();
+    if (len < varint_size + header_size)    return 0; // header 还没收全
+
+    // 反序列化 header，得到服务名、方法名（或方法编号）、参数长度和请求id
+    if (!frame->header.ParseFromArray(data + varint_size, static_cast<int>(header_size)))    return -1;
+
+    frame->frame_size = varint_size + header_size + frame->header.args_size();
+    if (len < frame->frame_size)    return 0; // 参数还没收全
+
+    frame->request_id = frame->header.request_id();
+    frame->method_id = frame->header.method_id();
+    frame->args_data = data + varint_size + header_size;
+    frame->args_size = static_cast<int>(frame->header.args_size());
+    frame->cancel = (frame->method_id == 0 && frame->header.service_name() == kKrpcCancelService);
+    return 1;
+}
+
+
+
+// 解析固定帧头的请求帧：【固定帧头】+【meta】+【参数 args】，帧头各字段在固定位置，不需要 protobuf 解析
+int KrpcProvider::ParseFixedRequestFrame(const char* data, size_t len, RequestFrame* frame)
+{
+    if (len < kKrpcFixedHeaderSize)     return 0;
+
+    KrpcFixedHeader fixed;
+    if (!KrpcDecodeFixedHeader(data, &fixed))  return -1;
+    if (fixed.body_length > static_cast<uint32_t>(INT_MAX) || fixed.meta_length > static_cast<uint32_t>(INT_MAX))    return -1;
+
+    frame->frame_size = kKrpcFixedHeaderSize + static_cast<size_t>(fixed.meta_length) + fixed.body_length;
+    if (len < frame->frame_size)    return 0;
+
+    // meta 只在没有方法编号等少数情况下才有，带着服务名、方法名
+    if (fixed.meta_length > 0 && !frame->header.ParseFromArray(data + kKrpcFixedHeaderSize, static_cast<int>(fixed.meta_length)))
+    {
+        return -1;
+    }
+
+    frame->request_id = fixed.request_id;
+    frame->method_id = fixed.method_id;
+    frame->args_data = data + kKrpcFixedHeaderSize + fixed.meta_length;
+    frame->args_size = static_cast<int>(fixed.body_length);
+    frame->cancel = (fixed.flags & kKrpcFlagCancel) != 0;
+    return 1;
+}
+
+
+
+// 连接状态在连接建立时（I/O 线程中）设置，之后只读，工作线程也可以直接访问
+KrpcProvider::ConnectionState* KrpcProvider::State(const muduo::net::TcpConnectionPtr &conn)
+{
+    const std::shared_ptr<ConnectionState>* state = boost::any_cast<std::shared_ptr<ConnectionState>>(&conn->getContext());
+    return (state != nullptr) ? state->get() : nullptr;
+}
+
+
+uint32_t KrpcProvider::FrameVersion(const muduo::net::TcpConnectionPtr &conn)
+{
+    ConnectionState* state = State(conn);
+    return (state != nullptr) ? state->frame_version.load(std::memory_order_acquire) : 0;
+}
+
+
+
+// 在锁外通知：NotifyOnCancel 的回调可能再访问连接状态
+void KrpcProvider::HandleCancel(const muduo::net::TcpConnectionPtr &conn, uint64_t request_id)
+{
+    std::shared_ptr<KrpcController> controller;
+    {
+        ConnectionState* state = State(conn);
+        std::lock_guard<std::mutex> lock(state->mutex);
+        auto it = state->active.find(request_id);
+        if (it == state->active.end())  return;
+        controller = it->second;
+    }
+    controller->StartCancel();
+}
+
+
+void KrpcProvider::RemoveActive(const muduo::net::TcpConnectionPtr &conn, uint64_t request_id)
+{
+    ConnectionState* state = State(conn);
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->active.erase(request_id);
+}
+
+
+
+// 回复握手请求：方法表在 Run 中生成，帧头版本取客户端和服务端都支持的最高版本
+// 回复本身仍使用 protobuf 帧头，发出后（当前就在连接所属的 I/O 线程中，会立即写入输出缓冲区）再切换这条连接的帧头
+void KrpcProvider::HandleHandshake(const muduo::net::TcpConnectionPtr &conn, const RequestFrame &frame)
+{
+    krpc::rpcHandshakeRequest request;
+    if (!request.ParseFromArray(frame.args_data, frame.args_size))
+    {
+        LOG(ERROR) << "handshake request parse error";
+        SendRpcError(conn, frame.request_id, krpc::RPC_BAD_REQUEST, "handshake request parse error");
+        return;
+    }
+
+    uint32_t version = 0;
+    if (max_frame_version >= kKrpcFrameVersion && request.max_frame_version() >= kKrpcFrameVersion)
+    {
+        version = kKrpcFrameVersion;
+    }
+
+    krpc::rpcHandshakeResponse response(handshake_response);
+    response.set_frame_version(version);
+    SendRpcResponse(conn, frame.request_id, &response);
+
+    if (version != 0)   State(conn)->frame_version.store(version, std::memory_order_release);
+}
+
+
+
+/*
+    组装响应帧并发送：【header长度(varint)】+【rpcResponseHeader（请求id + 响应长度 + 错误码）】+【响应 body】
+    协商了固定帧头的连接：【固定帧头（请求id + 响应长度 + 错误码）】+【meta（出错时为带错误信息的 rpcResponseHeader）】+【响应 body】
+    header 和 body 直接序列化到 KrpcIOBuf 的内存块中，中间不经过任何 std::string，大响应也不需要拼成一整块连续内存
+
+    body 可能在业务线程中序列化，而连接的 outputBuffer 只能在所属 I/O 线程中访问，
+    所以帧先写在 KrpcIOBuf 里，再交给 I/O 线程（只复制内存块引用）：逐块发送，输出缓冲区为空时直接写 socket
+*/
+void KrpcProvider::SendResponseFrame(const muduo::net::TcpConnectionPtr &conn, const krpc::rpcResponseHeader &response_header,
+                                     const google::protobuf::Message *body)
+{
+    KrpcIOBuf frame;
+    bool serialized = false;
+    if (FrameVersion(conn) != 0)
+    {
+        KrpcFixedHeader fixed;
+        fixed.flags = kKrpcFlagResponse;
+        fixed.error_code = static_cast<uint16_t>(response_header.error_code());
+        fixed.request_id = response_header.request_id();
+        fixed.body_length = response_header.body_size();
+        const google::protobuf::MessageLite* meta = response_header.error_text().empty() ? nullptr : &response_header;
+        serialized = KrpcSerializeFixedFrame(fixed, meta, body, &frame);
+    }
+    else
+    {
+        serialized = KrpcSerializeFrame(response_header, body, &frame);
+    }
+    if (!serialized)
+    {
+        LOG(ERROR) << "serialize response frame error";
+        return;
+    }
+
+    // 交回连接所属的 I/O 线程发送；本身就在 I/O 线程时立即发送
+    // 连接保持，客户端可以在同一条连接上继续发送请求
+    conn->getLoop()->runInLoop(std::bind(&KrpcProvider::SendInLoop, conn, std::move(frame)));
+}
+
+
+
+// 在连接所属的 I/O 线程中发送一帧数据，muduo 只接受连续内存，按内存块依次发送（同一线程内顺序不会乱）
+void KrpcProvider::SendInLoop(const muduo::net::TcpConnectionPtr &conn, const KrpcIOBuf &frame)
+{
+    if (!conn->connected())     return;
+    for (size_t i = 0; i < frame.BlockCount(); ++i)
+    {
+        conn->send(frame.BlockData(i), static_cast<int>(frame.BlockLength(i)));
+    }
+}
+
+
+
+KrpcProvider::~KrpcProvider()
+{
+    std::cout << "~KrpcProvider()" << std::endl;
+    event_loop.quit();
+    worker_pool.reset(); // 等待工作线程执行完剩余的请求
+}
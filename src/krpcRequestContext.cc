@@ -0,0 +1,59 @@
+#include "krpcRequestContext.h"
+
+#include <functional>
+#include <thread>
+
+
+namespace
+{
+
+thread_local std::shared_ptr<const KrpcRequestContext> t_current;
+
+// 当前线程的 splitmix64 随机数，生成调用链id 和 span id，各个线程的种子不同，结果不为 0
+uint64_t NextId()
+{
+    static thread_local uint64_t state = std::hash<std::thread::id>()(std::this_thread::get_id())
+                                         ^ static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+    uint64_t x;
+    do
+    {
+        state += 0x9e3779b97f4a7c15ULL;
+        x = state;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        x ^= x >> 31;
+    } while (x == 0);
+    return x;
+}
+
+} // namespace
+
+
+
+KrpcRequestContext::KrpcRequestContext(int64_t timeout_ms, uint64_t trace_id, uint64_t parent_span_id)
+    : m_hasDeadline(timeout_ms > 0),
+      m_traceId(trace_id != 0 ? trace_id : NextId()),
+      m_spanId(NextId()),
+      m_parentSpanId(parent_span_id)
+{
+    if (m_hasDeadline)  m_deadline = Clock::now() + std::chrono::milliseconds(timeout_ms);
+}
+
+
+
+const std::shared_ptr<const KrpcRequestContext>& KrpcRequestContext::Current()
+{
+    return t_current;
+}
+
+
+KrpcRequestContext::Scope::Scope(std::shared_ptr<const KrpcRequestContext> context) : m_previous(std::move(t_current))
+{
+    t_current = std::move(context);
+}
+
+
+KrpcRequestContext::Scope::~Scope()
+{
+    t_current = std::move(m_previous);
+}
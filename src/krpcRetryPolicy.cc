@@ -0,0 +1,105 @@
+#include "krpcRetryPolicy.h"
+#include "krpcApplication.h"
+
+#include <chrono>
+#include <functional>
+#include <random>
+#include <thread>
+
+
+std::unique_ptr<KrpcRetryPolicy> KrpcRetryPolicy::Create()
+{
+    KrpcConfig& config = KrpcApplication::GetConfig();
+    std::string methods = config.Load("rpcclient_retry_methods");
+    int max_attempts = config.LoadInt("rpcclient_retry_max_attempts", 3);
+    if (methods.empty() || max_attempts <= 1)   return nullptr;
+
+    std::unique_ptr<KrpcRetryPolicy> policy(new KrpcRetryPolicy(methods, config.Load("rpcclient_idempotent_methods"), max_attempts,
+                                                                config.LoadInt("rpcclient_retry_backoff_ms", 20),
+                                                                config.LoadInt("rpcclient_retry_max_backoff_ms", 1000),
+                                                                config.LoadInt("rpcclient_retry_budget_percent", 10)));
+    if (policy->m_retryMethods.Empty())     return nullptr;
+    return policy;
+}
+
+
+KrpcRetryPolicy::KrpcRetryPolicy(const std::string& methods, const std::string& idempotent_methods, int max_attempts,
+                                 int64_t backoff_ms, int64_t max_backoff_ms, int budget_percent)
+    : m_retryMethods(methods), m_idempotentMethods(idempotent_methods),
+      m_maxAttempts(max_attempts < 1 ? 1 : max_attempts),
+      m_backoffMs(backoff_ms < 1 ? 1 : backoff_ms),
+      m_budget(budget_percent, true)
+{
+    m_maxBackoffMs = (max_backoff_ms < m_backoffMs) ? m_backoffMs : max_backoff_ms;
+}
+
+
+
+// 逗号分隔的名单，忽略空白和空项
+KrpcRetryPolicy::MethodSet::MethodSet(const std::string& list) : m_all(false)
+{
+    size_t start = 0;
+    while (start <= list.size())
+    {
+        size_t end = list.find(',', start);
+        if (end == std::string::npos)   end = list.size();
+
+        std::string name = list.substr(start, end - start);
+        name.erase(0, name.find_first_not_of(" \t"));
+        name.erase(name.find_last_not_of(" \t") + 1);
+        if (name == "*")
+        {
+            m_all = true;
+        }
+        else if (name.size() > 2 && name.compare(name.size() - 2, 2, ".*") == 0)
+        {
+            m_services.insert(name.substr(0, name.size() - 2));
+        }
+        else if (!name.empty())
+        {
+            m_methods.insert(name);
+        }
+        start = end + 1;
+    }
+}
+
+
+// 方法全名、服务全名都是描述符里现成的字符串，查找时不需要拼接
+bool KrpcRetryPolicy::MethodSet::Match(const google::protobuf::MethodDescriptor* method) const
+{
+    if (m_all)  return true;
+    if (!m_methods.empty() && m_methods.count(method->full_name()) != 0)    return true;
+    return !m_services.empty() && m_services.count(method->service()->full_name()) != 0;
+}
+
+
+
+bool KrpcRetryPolicy::Retryable(const google::protobuf::MethodDescriptor* method, krpc::rpcErrorCode code) const
+{
+    switch (code)
+    {
+    case krpc::RPC_UNAVAILABLE:
+    case krpc::RPC_SERVER_BUSY:
+        return Enabled(method);
+    case krpc::RPC_CONNECTION_LOST:
+        return Enabled(method) && m_idempotentMethods.Match(method);
+    default:
+        return false;
+    }
+}
+
+
+
+int64_t KrpcRetryPolicy::BackoffMs(int retry) const
+{
+    // 当前线程的随机数，各个线程的种子不同
+    static thread_local std::minstd_rand rng(static_cast<std::minstd_rand::result_type>(
+        std::hash<std::thread::id>()(std::this_thread::get_id()) ^ static_cast<size_t>(std::chrono::steady_clock::now().time_since_epoch().count())));
+
+    int64_t delay = m_backoffMs;
+    for (int i = 1; i < retry && delay < m_maxBackoffMs; ++i)   delay *= 2;
+    if (delay > m_maxBackoffMs)     delay = m_maxBackoffMs;
+
+    int64_t half = delay / 2;
+    return delay - half + static_cast<int64_t>(rng() % static_cast<uint64_t>(half + 1));
+}
@@ -0,0 +1,227 @@
+#include "krpcServiceDiscovery.h"
+#include "krpcLogger.h"
+
+#include <stdlib.h>
+#include <vector>
+
+
+thread_local uint64_t KrpcServiceDiscovery::t_version = 0;
+thread_local std::shared_ptr<const KrpcServiceDiscovery::Snapshot> KrpcServiceDiscovery::t_snapshot;
+
+
+// 获取全局唯一的服务发现缓存（局部静态变量，C++11 保证初始化线程安全）
+KrpcServiceDiscovery& KrpcServiceDiscovery::GetInstance()
+{
+    static KrpcServiceDiscovery discovery;
+    return discovery;
+}
+
+
+KrpcServiceDiscovery::KrpcServiceDiscovery()
+    : m_expired(false), m_snapshot(std::make_shared<Snapshot>()), m_version(1)
+{
+}
+
+
+// 析构：关闭 zk 会话，之后不会再有 watch 回调
+// 关闭会话要等 zk 回调线程退出，而回调可能正在等 m_mutex，所以在锁外关闭
+KrpcServiceDiscovery::~KrpcServiceDiscovery()
+{
+    std::unique_ptr<ZkClient> zk;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        zk = std::move(m_zk);
+    }
+}
+
+
+
+const std::shared_ptr<const KrpcServiceDiscovery::Snapshot>& KrpcServiceDiscovery::Current()
+{
+    if (t_version != m_version.load(std::memory_order_acquire))
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        t_snapshot = m_snapshot;
+        t_version = m_version.load(std::memory_order_relaxed); // 锁内读取，与 m_snapshot 一致
+    }
+    return t_snapshot;
+}
+
+
+
+bool KrpcServiceDiscovery::Lookup(const std::string& path, std::shared_ptr<const KrpcServiceInstanceList>* instances)
+{
+    // 1. 查当前线程缓存的快照，命中时不加锁
+    const std::shared_ptr<const Snapshot>& snapshot = Current();
+    auto it = snapshot->find(path);
+    if (it != snapshot->end())
+    {
+        *instances = it->second;
+        return !it->second->empty();
+    }
+
+    // 2. 未命中：加锁后再查一次最新快照（可能已被其他线程查询过），仍没有再向 zk 查询并设置 watch
+    //    同一个节点只会被查询一次，大量 channel 同时启动时不会形成对 zk 的查询风暴
+    std::unique_ptr<ZkClient> expired; // 过期的会话在释放锁之后关闭（见析构函数），声明在锁之前
+    std::lock_guard<std::mutex> lock(m_mutex);
+    it = m_snapshot->find(path);
+    if (it == m_snapshot->end())
+    {
+        expired = EnsureSession();
+        std::shared_ptr<KrpcServiceInstanceList> fetched = std::make_shared<KrpcServiceInstanceList>();
+        int flag = Fetch(path, fetched.get());
+        if (flag != ZOK && flag != ZNONODE)
+        {
+            LOG(ERROR) << "query " << path << " error: " << flag;
+            return false; // 查询出错不缓存，下一次查询重试
+        }
+        Publish(path, fetched); // 节点不存在也缓存空列表，watch 会在节点创建后更新
+        it = m_snapshot->find(path);
+    }
+
+    *instances = it->second;
+    if (it->second->empty())
+    {
+        LOG(ERROR) << path << " has no provider!";
+        return false;
+    }
+    return true;
+}
+
+
+
+std::unique_ptr<ZkClient> KrpcServiceDiscovery::EnsureSession()
+{
+    std::unique_ptr<ZkClient> expired;
+    if (m_zk && !m_expired)     return expired;
+
+    expired = std::move(m_zk);
+    m_zk.reset(new ZkClient());
+    m_zk->Start();
+    m_expired = false;
+    return expired;
+}
+
+
+
+int KrpcServiceDiscovery::Fetch(const std::string& path, KrpcServiceInstanceList* instances)
+{
+    std::vector<std::string> children;
+    int flag = m_zk->GetChildrenWatch(path.c_str(), &KrpcServiceDiscovery::Watcher, this, &children);
+    if (flag != ZOK)    return flag;
+
+    // 子节点名为 ip:port，节点数据为权重；实例上下线由子节点 watch 通知，权重只在实例列表变化时重新读取
+    for (const std::string& child : children)
+    {
+        size_t idx = child.rfind(':');
+        if (idx == std::string::npos || idx == 0)
+        {
+            LOG(ERROR) << path << "/" << child << " address is invalid!";
+            continue;
+        }
+        KrpcServiceInstance instance;
+        instance.ip = child.substr(0, idx);
+        instance.port = static_cast<uint16_t>(atoi(child.c_str() + idx + 1));
+        std::string weight = m_zk->GetData((path + "/" + child).c_str());
+        // 节点数据来自其他进程，不可信：解析失败或不是正数时用默认权重，过大时按上限处理
+        long value = weight.empty() ? kKrpcDefaultWeight : strtol(weight.c_str(), nullptr, 10);
+        if (value <= 0)     value = kKrpcDefaultWeight;
+        instance.weight = static_cast<int>(value > kKrpcMaxWeight ? kKrpcMaxWeight : value);
+        instance.stats = KrpcEndpointStats::Get(instance.ip, instance.port);
+        instances->push_back(instance);
+    }
+
+    // 旧版本服务端把 ip:port 直接写在方法节点上（临时节点，没有子节点）
+    if (children.empty())
+    {
+        std::string host_data = m_zk->GetData(path.c_str());
+        size_t idx = host_data.find(':');
+        if (idx != std::string::npos)
+        {
+            KrpcServiceInstance instance;
+            instance.ip = host_data.substr(0, idx);
+            instance.port = static_cast<uint16_t>(atoi(host_data.c_str() + idx + 1));
+            instance.weight = kKrpcDefaultWeight;
+            instance.stats = KrpcEndpointStats::Get(instance.ip, instance.port);
+            instances->push_back(instance);
+        }
+    }
+    return ZOK;
+}
+
+
+
+// 两个实例列表是否相同（zk 返回的子节点顺序不变，按顺序比较即可）
+static bool SameInstances(const KrpcServiceInstanceList& a, const KrpcServiceInstanceList& b)
+{
+    if (a.size() != b.size())   return false;
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        if (a[i].ip != b[i].ip || a[i].port != b[i].port || a[i].weight != b[i].weight)    return false;
+    }
+    return true;
+}
+
+
+void KrpcServiceDiscovery::Publish(const std::string& path, const InstanceListPtr& instances)
+{
+    auto it = m_snapshot->find(path);
+    if (it != m_snapshot->end() && SameInstances(*it->second, *instances))  return;
+
+    // 写时复制：正在使用旧快照的线程不受影响，旧快照随最后一个引用释放
+    std::shared_ptr<Snapshot> snapshot = std::make_shared<Snapshot>(*m_snapshot);
+    (*snapshot)[path] = instances;
+
+    m_snapshot = snapshot;
+    m_version.fetch_add(1, std::memory_order_release);
+}
+
+
+
+void KrpcServiceDiscovery::Refresh(const std::string& path)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_zk || m_expired)     return;
+
+    // 重新读取的同时重新设置 watch（zk 的 watch 只触发一次），节点被删除时发布空列表
+    std::shared_ptr<KrpcServiceInstanceList> instances = std::make_shared<KrpcServiceInstanceList>();
+    int flag = Fetch(path, instances.get());
+    if (flag == ZOK || flag == ZNONODE)
+    {
+        LOG(INFO) << path << " providers: " << instances->size();
+        Publish(path, instances);
+    }
+    else
+    {
+        LOG(ERROR) << "refresh " << path << " error: " << flag;
+    }
+}
+
+
+
+void KrpcServiceDiscovery::OnSessionExpired()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_expired)  return;
+
+    LOG(ERROR) << "zookeeper session expired, discovery cache cleared";
+    m_expired = true; // zk 回调线程中不能关闭会话，留给下一次查询重建
+    m_snapshot = std::make_shared<Snapshot>();
+    m_version.fetch_add(1, std::memory_order_release);
+}
+
+
+
+// 节点 watch 的回调，在 zk 的回调线程中执行；会话事件也会通知到每个 watch
+void KrpcServiceDiscovery::Watcher(zhandle_t* zh, int type, int state, const char* path, void* watcherCtx)
+{
+    KrpcServiceDiscovery* self = static_cast<KrpcServiceDiscovery*>(watcherCtx);
+    if (type == ZOO_SESSION_EVENT)
+    {
+        if (state == ZOO_EXPIRED_SESSION_STATE)     self->OnSessionExpired();
+        return;
+    }
+    if (type == ZOO_NOTWATCHING_EVENT || path == nullptr || path[0] == '\0')     return;
+
+    self->Refresh(path);
+}
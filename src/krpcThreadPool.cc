@@ -0,0 +1,88 @@
+#include "krpcThreadPool.h"
+
+#include <chrono>
+
+
+KrpcThreadPool::KrpcThreadPool(int threads, size_t queue_size)
+    : m_queue(queue_size), m_quit(false), m_sleepers(0)
+{
+    if (threads < 1)    threads = 1;
+    for (int i = 0; i < threads; ++i)
+    {
+        m_threads.emplace_back(&KrpcThreadPool::WorkerLoop, this);
+    }
+}
+
+
+KrpcThreadPool::~KrpcThreadPool()
+{
+    m_quit.store(true);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_cond.notify_all();
+    }
+    for (std::thread& t : m_threads)
+    {
+        if (t.joinable())   t.join();
+    }
+}
+
+
+
+// 投递任务：入队后只有存在睡眠的工作线程时才加锁唤醒
+// 与 WorkerLoop 配合：工作线程先登记 m_sleepers 再检查队列，投递方先入队再检查 m_sleepers，
+// 两边都用顺序一致的原子操作，至少有一方能看到对方，不会丢失唤醒
+bool KrpcThreadPool::Submit(Task task)
+{
+    if (!m_queue.TryPush(std::move(task)))  return false;
+
+    if (m_sleepers.load() > 0)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_cond.notify_one();
+    }
+    return true;
+}
+
+
+
+void KrpcThreadPool::WorkerLoop()
+{
+    Task task;
+    for (;;)
+    {
+        // 1. 取任务，取不到时先自旋，短时间内有新任务到来就不用睡眠
+        bool got = false;
+        for (int i = 0; i < kSpinCount && !got; ++i)
+        {
+            got = m_queue.TryPop(task);
+            if (!got)   std::this_thread::yield();
+        }
+
+        if (got)
+        {
+            task();
+            task = nullptr;
+            continue;
+        }
+
+        if (m_quit.load())  break; // 队列已空，退出
+
+        // 2. 睡眠等待：登记后再检查一次队列，避免在登记之前投递的任务没人唤醒
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_sleepers.fetch_add(1);
+        if (m_queue.TryPop(task))
+        {
+            m_sleepers.fetch_sub(1);
+            lock.unlock();
+            task();
+            task = nullptr;
+            continue;
+        }
+        if (!m_quit.load())
+        {
+            m_cond.wait_for(lock, std::chrono::milliseconds(100));
+        }
+        m_sleepers.fetch_sub(1);
+    }
+}
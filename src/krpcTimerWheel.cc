@@ -0,0 +1,191 @@
+#include "krpcTimerWheel.h"
+
+
+// 获取全局唯一的时间轮（局部静态变量，C++11 保证初始化线程安全，程序退出时停止后台线程）
+KrpcTimerWheel& KrpcTimerWheel::GetInstance()
+{
+    static KrpcTimerWheel wheel;
+    return wheel;
+}
+
+
+KrpcTimerWheel::KrpcTimerWheel()
+    : m_current(0), m_wakeTick(0), m_count(0), m_stop(false), m_start(std::chrono::steady_clock::now())
+{
+    for (int level = 0; level < kLevels; ++level)
+    {
+        for (uint64_t slot = 0; slot < kSlots; ++slot)  m_slots[level][slot] = nullptr;
+    }
+    m_thread = std::thread(&KrpcTimerWheel::Run, this);
+}
+
+
+// 析构：停止后台线程，还挂在时间轮上的定时器不再执行
+KrpcTimerWheel::~KrpcTimerWheel()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cond.notify_all();
+    if (m_thread.joinable())    m_thread.join();
+}
+
+
+
+uint64_t KrpcTimerWheel::NowTick() const
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_start).count());
+}
+
+
+
+void KrpcTimerWheel::Add(Timer* timer, int64_t timeout_ms)
+{
+    if (timeout_ms < 1)     timeout_ms = 1;
+    uint64_t ticks = static_cast<uint64_t>(timeout_ms);
+    if (ticks > kMaxTicks)  ticks = kMaxTicks;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    uint64_t now = NowTick();
+    if (m_count == 0)   m_current = now; // 时间轮是空的，直接跳到当前时刻，不需要逐个 tick 推进
+
+    // 当前时刻可能已经过了 now 这个 tick 的一部分，多加一个 tick 保证回调不会提前执行
+    // 到期时间至少是下一个 tick（当前 tick 的槽已经处理过），后台线程落后时相对 m_current 的距离不超过上限
+    timer->expire = now + ticks + 1;
+    if (timer->expire <= m_current)                 timer->expire = m_current + 1;
+    if (timer->expire - m_current > kMaxTicks)      timer->expire = m_current + kMaxTicks;
+    Place(timer);
+    ++m_count;
+
+    if (timer->expire < m_wakeTick || m_count == 1)     m_cond.notify_one(); // 比后台线程计划醒来的时间更早
+}
+
+
+bool KrpcTimerWheel::Cancel(Timer* timer)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (timer->pprev == nullptr)    return false;
+    Unlink(timer);
+    --m_count;
+    return true;
+}
+
+
+
+// 距离到期不足 64^(level+1) 个 tick 的定时器放在第 level 层，槽号取到期时间的对应位
+void KrpcTimerWheel::Place(Timer* timer)
+{
+    uint64_t delta = (timer->expire > m_current) ? timer->expire - m_current : 0;
+    int level = 0;
+    while (level < kLevels - 1 && delta >= (1ULL << (kLevelBits * (level + 1))))  ++level;
+
+    Timer** head = &m_slots[level][(timer->expire >> (kLevelBits * level)) & kSlotMask];
+    timer->next = *head;
+    if (timer->next != nullptr)     timer->next->pprev = &timer->next;
+    timer->pprev = head;
+    *head = timer;
+}
+
+
+void KrpcTimerWheel::Unlink(Timer* timer)
+{
+    *timer->pprev = timer->next;
+    if (timer->next != nullptr)     timer->next->pprev = timer->pprev;
+    timer->next = nullptr;
+    timer->pprev = nullptr;
+}
+
+
+
+void KrpcTimerWheel::Advance()
+{
+    ++m_current;
+
+    // 低层转完一圈，把高层当前槽里的定时器重新分配到低层（其中已经到期的会落在 level 0 的当前槽）
+    for (int level = 1; level < kLevels; ++level)
+    {
+        if ((m_current & ((1ULL << (kLevelBits * level)) - 1)) != 0)     break;
+
+        Timer* list = m_slots[level][(m_current >> (kLevelBits * level)) & kSlotMask];
+        m_slots[level][(m_current >> (kLevelBits * level)) & kSlotMask] = nullptr;
+        while (list != nullptr)
+        {
+            Timer* timer = list;
+            list = timer->next;
+            Place(timer);
+        }
+    }
+
+    // level 0 当前槽里的定时器全部到期，取出回调信息后节点就与时间轮无关了
+    Timer* list = m_slots[0][m_current & kSlotMask];
+    m_slots[0][m_current & kSlotMask] = nullptr;
+    while (list != nullptr)
+    {
+        Timer* timer = list;
+        list = timer->next;
+        timer->next = nullptr;
+        timer->pprev = nullptr;
+        --m_count;
+
+        Expired expired;
+        expired.callback = timer->callback;
+        expired.ctx = timer->ctx;
+        expired.arg = timer->arg;
+        expired.owner = timer->owner;
+        m_expired.push_back(std::move(expired));
+    }
+}
+
+
+// level 0 后面 63 个槽里第一个非空的槽；都为空时是下一次 cascade 的时刻（高层的定时器最早在那时才会落到 level 0）
+uint64_t KrpcTimerWheel::NextWakeTick() const
+{
+    for (uint64_t i = 1; i < kSlots; ++i)
+    {
+        if ((m_current + i) % kSlots == 0)                      return m_current + i;
+        if (m_slots[0][(m_current + i) & kSlotMask] != nullptr) return m_current + i;
+    }
+    return m_current + kSlots;
+}
+
+
+
+void KrpcTimerWheel::Run()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stop)
+    {
+        if (m_count == 0)
+        {
+            m_wakeTick = UINT64_MAX;
+            m_cond.wait(lock);
+            continue;
+        }
+
+        // 睡到下一个需要处理的 tick，期间加入了更早到期的定时器会被提前唤醒
+        m_wakeTick = NextWakeTick();
+        uint64_t now = NowTick();
+        if (now < m_wakeTick)
+        {
+            m_cond.wait_for(lock, std::chrono::milliseconds(m_wakeTick - now));
+            if (m_stop)     break;
+            now = NowTick();
+        }
+
+        while (m_current < now && m_count > 0)  Advance();
+        if (m_count == 0)   m_current = now;
+
+        // 在锁外执行回调，回调中可以再加入 / 取消定时器
+        if (!m_expired.empty())
+        {
+            lock.unlock();
+            for (Expired& expired : m_expired)
+            {
+                expired.callback(expired.ctx, expired.arg);
+            }
+            m_expired.clear(); // 释放 owner，可能析构 ctx 所属的对象，所以也在锁外
+            lock.lock();
+        }
+    }
+}
@@ -0,0 +1,33 @@
+#include "krpcTokenBudget.h"
+
+
+KrpcTokenBudget::KrpcTokenBudget(int percent, bool full)
+    : m_percent(percent < 0 ? 0 : (percent > 100 ? 100 : percent)),
+      m_budget(full ? kMaxBudget : 0)
+{
+}
+
+
+
+void KrpcTokenBudget::Deposit()
+{
+    int64_t old = m_budget.load(std::memory_order_relaxed);
+    int64_t next;
+    do
+    {
+        if (old >= kMaxBudget)  return;
+        next = old + m_percent;
+        if (next > kMaxBudget)  next = kMaxBudget;
+    } while (!m_budget.compare_exchange_weak(old, next, std::memory_order_relaxed));
+}
+
+
+bool KrpcTokenBudget::Withdraw()
+{
+    int64_t old = m_budget.load(std::memory_order_relaxed);
+    do
+    {
+        if (old < kCost)    return false;
+    } while (!m_budget.compare_exchange_weak(old, old - kCost, std::memory_order_relaxed));
+    return true;
+}
@@ -0,0 +1,262 @@
+#include "krpcWorkStealingExecutor.h"
+
+#include <chrono>
+
+
+KrpcWorkStealingDeque::KrpcWorkStealingDeque(size_t capacity)
+    : m_top(0), m_bottom(0)
+{
+    size_t size = 2;
+    while (size < capacity)     size <<= 1;
+    m_mask = static_cast<int64_t>(size - 1);
+    m_slots.reset(new std::atomic<Task*>[size]);
+    for (size_t i = 0; i < size; ++i)
+    {
+        m_slots[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+
+bool KrpcWorkStealingDeque::Push(Task* task)
+{
+    int64_t b = m_bottom.load(std::memory_order_relaxed);
+    int64_t t = m_top.load(std::memory_order_acquire);
+    if (b - t > m_mask)     return false; // 队列满
+
+    m_slots[b & m_mask].store(task, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release); // 先写槽位，再让窃取方看到新的 bottom
+    m_bottom.store(b + 1, std::memory_order_relaxed);
+    return true;
+}
+
+
+// 所属线程从底部取：先把 bottom 减一“预订”任务，只剩最后一个任务时与窃取方 CAS 争抢 top
+KrpcWorkStealingDeque::Task* KrpcWorkStealingDeque::Pop()
+{
+    int64_t b = m_bottom.load(std::memory_order_relaxed) - 1;
+    m_bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = m_top.load(std::memory_order_relaxed);
+
+    if (t > b)
+    {
+        m_bottom.store(b + 1, std::memory_order_relaxed); // 队列为空，恢复 bottom
+        return nullptr;
+    }
+
+    Task* task = m_slots[b & m_mask].load(std::memory_order_relaxed);
+    if (t == b)
+    {
+        // 最后一个任务，可能同时被窃取
+        if (!m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            task = nullptr;
+        }
+        m_bottom.store(b + 1, std::memory_order_relaxed);
+    }
+    return task;
+}
+
+
+// 其他线程从顶部窃取
+KrpcWorkStealingDeque::Task* KrpcWorkStealingDeque::Steal()
+{
+    int64_t t = m_top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t b = m_bottom.load(std::memory_order_acquire);
+    if (t >= b)     return nullptr;
+
+    Task* task = m_slots[t & m_mask].load(std::memory_order_relaxed);
+    if (!m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+    {
+        return nullptr; // 被所属线程或其他窃取方抢先
+    }
+    return task;
+}
+
+
+
+
+thread_local KrpcWorkStealingExecutor::Worker* KrpcWorkStealingExecutor::t_worker = nullptr;
+thread_local KrpcWorkStealingExecutor* KrpcWorkStealingExecutor::t_executor = nullptr;
+
+
+KrpcWorkStealingExecutor::KrpcWorkStealingExecutor(int threads, size_t queue_size)
+    : m_inject(queue_size), m_quit(false), m_sleepers(0)
+{
+    if (threads < 1)    threads = 1;
+    for (int i = 0; i < threads; ++i)
+    {
+        m_workers.emplace_back(new Worker());
+        m_workers.back()->random = static_cast<uint32_t>(i) * 2654435761u + 1; // 每个线程不同的随机种子，不能为 0
+    }
+    // 所有 Worker 创建完再启动线程，窃取时可以安全地遍历 m_workers
+    for (auto& worker : m_workers)
+    {
+        worker->thread = std::thread(&KrpcWorkStealingExecutor::WorkerLoop, this, worker.get());
+    }
+}
+
+
+KrpcWorkStealingExecutor::~KrpcWorkStealingExecutor()
+{
+    m_quit.store(true);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_cond.notify_all();
+    }
+    for (auto& worker : m_workers)
+    {
+        if (worker->thread.joinable())  worker->thread.join();
+    }
+}
+
+
+
+// 投递任务：工作线程内部投递的放进自己的 LIFO 槽位，外部线程投递的放进全局注入队列
+bool KrpcWorkStealingExecutor::Submit(Task task)
+{
+    Task* ptask = new Task(std::move(task));
+
+    Worker* worker = (t_executor == this) ? t_worker : nullptr;
+    if (worker != nullptr)
+    {
+        // 槽位里原来的任务挪进本地队列，本地队列满了再放进全局注入队列
+        if (worker->lifo != nullptr)
+        {
+            if (!worker->deque.Push(worker->lifo) && !m_inject.TryPush(std::move(worker->lifo)))
+            {
+                delete ptask; // 都满了，原来的任务留在槽位里，拒绝新任务
+                return false;
+            }
+        }
+        worker->lifo = ptask;
+    }
+    else if (!m_inject.TryPush(std::move(ptask)))
+    {
+        delete ptask;
+        return false;
+    }
+
+    NotifyOne();
+    return true;
+}
+
+
+
+void KrpcWorkStealingExecutor::NotifyOne()
+{
+    // 与 WorkerLoop 配合：工作线程先登记 m_sleepers 再检查任务，投递方先放任务再检查 m_sleepers，不会丢失唤醒
+    if (m_sleepers.load() > 0)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_cond.notify_one();
+    }
+}
+
+
+
+KrpcWorkStealingExecutor::Task* KrpcWorkStealingExecutor::FindTask(Worker* worker)
+{
+    // 1. LIFO 槽位，连续执行次数达到上限后挪进本地队列，让位给更早的任务
+    if (worker->lifo != nullptr)
+    {
+        Task* task = worker->lifo;
+        worker->lifo = nullptr;
+        if (worker->lifoRuns < kMaxLifoRuns)
+        {
+            ++worker->lifoRuns;
+            return task;
+        }
+        if (!worker->deque.Push(task) && !m_inject.TryPush(std::move(task)))
+        {
+            return task; // 放不回去就直接执行
+        }
+    }
+    worker->lifoRuns = 0;
+
+    // 2. 本地队列
+    Task* task = worker->deque.Pop();
+    if (task != nullptr)    return task;
+
+    // 3. 全局注入队列
+    if (m_inject.TryPop(task))  return task;
+
+    // 4. 窃取其他线程的本地队列
+    return StealTask(worker);
+}
+
+
+
+// 从随机位置开始遍历其他工作线程，窃取它们本地队列里最早的任务
+KrpcWorkStealingExecutor::Task* KrpcWorkStealingExecutor::StealTask(Worker* worker)
+{
+    size_t n = m_workers.size();
+    if (n < 2)  return nullptr;
+
+    // xorshift 随机数
+    uint32_t x = worker->random;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    worker->random = x;
+
+    size_t start = x % n;
+    for (size_t i = 0; i < n; ++i)
+    {
+        Worker* victim = m_workers[(start + i) % n].get();
+        if (victim == worker)   continue;
+        Task* task = victim->deque.Steal();
+        if (task != nullptr)    return task;
+    }
+    return nullptr;
+}
+
+
+
+void KrpcWorkStealingExecutor::WorkerLoop(Worker* worker)
+{
+    t_worker = worker;
+    t_executor = this;
+
+    for (;;)
+    {
+        // 1. 取任务，取不到时先自旋，短时间内有新任务到来就不用睡眠
+        Task* task = nullptr;
+        for (int i = 0; i < kSpinCount && task == nullptr; ++i)
+        {
+            task = FindTask(worker);
+            if (task == nullptr)    std::this_thread::yield();
+        }
+
+        if (task != nullptr)
+        {
+            (*task)();
+            delete task;
+            continue;
+        }
+
+        if (m_quit.load())  break; // 所有队列都空了，退出
+
+        // 2. 睡眠等待：登记后再找一次任务，避免在登记之前投递的任务没人唤醒
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_sleepers.fetch_add(1);
+        task = FindTask(worker);
+        if (task != nullptr)
+        {
+            m_sleepers.fetch_sub(1);
+            lock.unlock();
+            (*task)();
+            delete task;
+            continue;
+        }
+        if (!m_quit.load())
+        {
+            m_cond.wait_for(lock, std::chrono::milliseconds(100));
+        }
+        m_sleepers.fetch_sub(1);
+    }
+
+    t_worker = nullptr;
+    t_executor = nullptr;
+}
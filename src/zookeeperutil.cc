@@ -137,10 +137,44 @@ std::string ZkClient::GetData(const char *path)
         LOG(ERROR) << "zoo_get error";
         return "";
     }
-    else // 获取成功，返回节点数据
+    else // 获取成功，返回节点数据（zoo_get 不保证以 '\0' 结尾，按返回的长度构造）
     {
-        return buf; 
+        return std::string(buf, bufferlen > 0 ? bufferlen : 0);
     }
 
     return ""; // 默认返回空字符串
 }
+
+
+
+// 获取子节点列表并设置 watch zoo_wget_children()，节点不存在时用 zoo_wexists() 监视节点的创建
+int ZkClient::GetChildrenWatch(const char *path, watcher_fn watcher, void *watcherCtx, std::vector<std::string> *children)
+{
+    int flag = ZNONODE;
+    for (int i = 0; i < 2; ++i)
+    {
+        struct String_vector strings;
+        flag = zoo_wget_children(m_zhandle, path, watcher, watcherCtx, &strings);
+        if (flag == ZOK)
+        {
+            children->clear();
+            for (int j = 0; j < strings.count; ++j)
+            {
+                children->push_back(strings.data[j]);
+            }
+            deallocate_String_vector(&strings);
+            return flag;
+        }
+        if (flag != ZNONODE)    break;
+
+        // 节点不存在时 zoo_wget_children 不会留下 watch，改为监视创建（zoo_wexists 返回 ZNONODE 时 watch 已设置）
+        // 两次调用之间节点被创建了（返回 ZOK）则重新读取一次
+        int exists = zoo_wexists(m_zhandle, path, watcher, watcherCtx, nullptr);
+        if (exists != ZOK)
+        {
+            if (exists != ZNONODE)  flag = exists;
+            break;
+        }
+    }
+    return flag;
+}
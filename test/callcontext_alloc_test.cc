@@ -0,0 +1,169 @@
+#include "echo.pb.h"
+#include "krpcApplication.h"
+#include "krpcProvider.h"
+#include "krpcCallContext.h"
+#include "krpcClientLoop.h"
+#include "krpcLogger.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <thread>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+
+
+/*
+分配计数测试：在进程内启动服务端，同步调用达到稳定状态后，客户端每次调用申请堆内存的次数应为 0
+
+    - 替换全局 operator new，计数期间统计调用线程和客户端 I/O 线程（解析响应、执行回调）上的分配，
+      服务端的线程不计入
+    - 请求和响应在循环中复用，控制器取自 KrpcCallContext::Controller()，与 example/caller 的用法一致
+    - 响应消息只有标量和 bytes 字段：protobuf 解析前的 Clear 会释放 proto3 的子消息字段，
+      带子消息的响应每次调用都要重新申请，那是消息类型本身的开销，不属于框架
+    - 需要配置文件中的 zookeeper 可以连接（服务注册和发现都经过 zookeeper），连接不上时跳过（返回 77）
+*/
+
+const int kSkipped = 77;        // ctest 的 SKIP_RETURN_CODE
+const int kWarmupCalls = 200;   // 预热：建立连接、握手、填满各个线程缓存
+const int kCountedCalls = 2000;
+
+
+static std::atomic<bool> g_counting(false);
+static std::atomic<long> g_allocs(0);
+static thread_local bool t_caller = false;
+
+void* operator new(size_t size)
+{
+    if (g_counting.load(std::memory_order_relaxed) && (t_caller || KrpcClientLoop::InClientLoopThread()))
+    {
+        g_allocs.fetch_add(1, std::memory_order_relaxed);
+    }
+    void* p = malloc(size != 0 ? size : 1);
+    if (p == nullptr)   throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+
+
+// 回显服务：在服务端的工作线程中执行
+class EchoService : public ktest::EchoServiceRpc
+{
+public:
+    void Echo(::google::protobuf::RpcController* controller,
+              const ::ktest::EchoRequest* request,
+              ::ktest::EchoResponse* response,
+              ::google::protobuf::Closure* done) override
+    {
+        response->set_errcode(0);
+        response->set_payload(request->payload());
+        done->Run();
+    }
+};
+
+
+
+// 配置文件中的 zookeeper 能否连接
+static bool ZookeeperReachable()
+{
+    KrpcConfig& config = KrpcApplication::GetConfig();
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(static_cast<uint16_t>(atoi(config.Load("zookeeperport").c_str())));
+    if (inet_pton(AF_INET, config.Load("zookeeperip").c_str(), &addr.sin_addr) != 1)  return false;
+
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0)     return false;
+    bool ok = (connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0);
+    close(fd);
+    return ok;
+}
+
+
+
+// 测试结束时服务端还在事件循环中，没有办法从外部停止，直接结束进程
+static void Finish(int code)
+{
+    std::cout.flush();
+    _exit(code);
+}
+
+
+
+int main(int argc, char** argv)
+{
+    KrpcApplication::Init(argc, argv);
+    KrpcLogger logger("callcontext_alloc_test");
+
+    if (!ZookeeperReachable())
+    {
+        std::cout << "zookeeper is not reachable, skipped" << std::endl;
+        Finish(kSkipped);
+    }
+
+    // 服务端的事件循环要在创建它的线程中运行，provider 在服务端线程中创建
+    std::thread([]() {
+        KrpcProvider provider;
+        provider.NotifyService(new EchoService());
+        provider.Run();
+    }).detach();
+
+    KrpcChannel channel(false);
+    ktest::EchoServiceRpc_Stub stub(&channel);
+    ktest::EchoRequest request;
+    request.set_payload("zhangsan:123456");
+    ktest::EchoResponse response;
+
+    // 等服务端注册到 zookeeper，最多 10 秒
+    bool ready = false;
+    for (int i = 0; i < 100 && !ready; ++i)
+    {
+        KrpcController& controller = KrpcCallContext::Controller();
+        stub.Echo(&controller, &request, &response, nullptr);
+        ready = !controller.Failed();
+        if (!ready)     usleep(100 * 1000);
+    }
+    if (!ready)
+    {
+        std::cout << "provider is not ready" << std::endl;
+        Finish(EXIT_FAILURE);
+    }
+
+    for (int i = 0; i < kWarmupCalls; ++i)
+    {
+        KrpcController& controller = KrpcCallContext::Controller();
+        stub.Echo(&controller, &request, &response, nullptr);
+        if (controller.Failed())
+        {
+            std::cout << "warm-up call failed: " << controller.ErrorTextRef() << std::endl;
+            Finish(EXIT_FAILURE);
+        }
+    }
+
+    t_caller = true;
+    long worst = 0;
+    for (int i = 0; i < kCountedCalls; ++i)
+    {
+        g_allocs.store(0);
+        g_counting.store(true);
+        KrpcController& controller = KrpcCallContext::Controller();
+        stub.Echo(&controller, &request, &response, nullptr);
+        g_counting.store(false);
+
+        if (controller.Failed() || response.errcode() != 0 || response.payload() != request.payload())
+        {
+            std::cout << "call " << i << " failed: " << controller.ErrorTextRef() << std::endl;
+            Finish(EXIT_FAILURE);
+        }
+        if (g_allocs.load() > worst)    worst = g_allocs.load();
+    }
+    t_caller = false;
+
+    std::cout << "max allocations per call in steady state: " << worst << std::endl;
+    Finish(worst == 0 ? EXIT_SUCCESS : EXIT_FAILURE);
+}